@@ -0,0 +1,67 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "bench_tools.hpp"
+
+/**
+ * Replaces the global allocation functions to count the allocations of the benchmarks. The array and
+ * nothrow forms of operator new call these by default.
+ */
+
+namespace {
+
+std::atomic<gbase::Size> allocations{0};
+
+void *allocate(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void *allocate(std::size_t size, std::align_val_t alignment) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    const auto align = static_cast<std::size_t>(alignment);
+    const std::size_t rounded = (size + align - 1) / align * align;
+#if defined(_WIN32)
+    void *memory = _aligned_malloc(rounded == 0 ? align : rounded, align);
+#else
+    void *memory = std::aligned_alloc(align, rounded == 0 ? align : rounded);
+#endif
+    if (memory == nullptr) {
+        throw std::bad_alloc{};
+    }
+    return memory;
+}
+
+void deallocateAligned(void *memory) {
+#if defined(_WIN32)
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+} // namespace
+
+namespace gbase::bench {
+
+Size allocationCount() { return allocations.load(std::memory_order_relaxed); }
+
+} // namespace gbase::bench
+
+void *operator new(std::size_t size) { return allocate(size); }
+void *operator new[](std::size_t size) { return allocate(size); }
+void *operator new(std::size_t size, std::align_val_t alignment) { return allocate(size, alignment); }
+void *operator new[](std::size_t size, std::align_val_t alignment) { return allocate(size, alignment); }
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void *memory, std::align_val_t) noexcept { deallocateAligned(memory); }
+void operator delete[](void *memory, std::align_val_t) noexcept { deallocateAligned(memory); }
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept { deallocateAligned(memory); }
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept { deallocateAligned(memory); }
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <format>
+#include <string>
+#include <vector>
+
+#include "bench_tools.hpp"
+#include "g_connections.hpp"
+
+/**
+ * Measures the cost of notifying GSignal connections, and of connecting and disconnecting, for a number of
+ * subscriber counts, and prints ns/call and allocations/call. A call is one notify() or one connect() plus
+ * disconnect(). An array of plain function pointers serves as the baseline for broadcasts.
+ *
+ * Usage: bench_connections [calls per scenario with one subscriber]
+ */
+
+using namespace gbase;
+using namespace gbase::bench;
+
+namespace {
+
+constexpr Size DefaultCalls = 1'000'000;
+constexpr Size MinimumCalls = 100;
+constexpr Size SubscriberCounts[] = {1, 10, 100, 1000, 10'000};
+
+struct Subject {};
+
+struct Subscriber : public GConnectable {
+    void onValue(Subject *, const Integer &value) { sum += value; }
+    void onNotify(Subject *) { ++sum; }
+
+    Integer sum{0};
+};
+
+/**
+ * @brief The baseline: a plain function pointer and an instance per subscriber, without any type erasure.
+ */
+struct RawSlot {
+    void (*function)(void *, Subject *, const Integer &);
+    void *instance;
+};
+
+template <auto MemberFunc> void callMember(void *instance, Subject *subject, const Integer &value) {
+    (static_cast<Subscriber *>(instance)->*MemberFunc)(subject, value);
+}
+
+/**
+ * @brief Spreads the calls over the subscribers, so each scenario makes about the same number of callbacks.
+ */
+Size callsFor(Size calls, Size subscribers) { return std::max(calls / subscribers, MinimumCalls); }
+
+void measureBroadcasts(std::vector<GBenchResult> &results, Size calls, Size count) {
+    Subject subject;
+    std::vector<Subscriber> subscribers(count);
+    const Size broadcasts = callsFor(calls, count);
+    const auto name = [count](const char *scenario) {
+        return std::format("{}, {} subscribers", scenario, count);
+    };
+
+    std::vector<RawSlot> rawSlots;
+    for (auto &subscriber : subscribers) {
+        rawSlots.push_back({&callMember<&Subscriber::onValue>, &subscriber});
+    }
+    results.push_back(measure(name("Raw function pointers"), broadcasts, 1, [&](Size i) {
+        const Integer value = static_cast<Integer>(i);
+        for (const auto &slot : rawSlots) {
+            slot.function(slot.instance, &subject, value);
+        }
+    }));
+
+    G1PConnector<Subject, Integer> memberSignal;
+    G1PConnector<Subject, Integer> lambdaSignal;
+    G0PConnector<Subject> noParameterSignal;
+    std::vector<GConnectionHandle> handles;
+    for (auto &subscriber : subscribers) {
+        handles.push_back(memberSignal.connect<&Subscriber::onValue>(&subscriber));
+        lambdaSignal.connect(&subscriber, [&subscriber](Subject *, const Integer &value) {
+            subscriber.sum += value;
+        });
+        noParameterSignal.connect<&Subscriber::onNotify>(&subscriber);
+    }
+
+    results.push_back(measure(name("G1P notify, member slots"), broadcasts, 1,
+                              [&](Size i) { memberSignal.notify(&subject, static_cast<Integer>(i)); }));
+    results.push_back(measure(name("G1P notify, lambda slots"), broadcasts, 1,
+                              [&](Size i) { lambdaSignal.notify(&subject, static_cast<Integer>(i)); }));
+    results.push_back(measure(name("G0P notify, member slots"), broadcasts, 1,
+                              [&](Size) { noParameterSignal.notify(&subject); }));
+
+    results.push_back(measure(name("G1P targeted notify, handle"), calls, 1, [&](Size i) {
+        memberSignal.notify(&subject, handles[i % count], static_cast<Integer>(i));
+    }));
+    results.push_back(measure(name("G1P targeted notify, instance"), callsFor(calls, count), 1, [&](Size i) {
+        memberSignal.notify(&subject, &subscribers[i % count], static_cast<Integer>(i));
+    }));
+
+    Subscriber extra;
+    results.push_back(measure(name("G1P connect and disconnect"), callsFor(calls / 10, count), 1, [&](Size) {
+        memberSignal.disconnect(memberSignal.connect<&Subscriber::onValue>(&extra));
+    }));
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const Size calls = argc > 1 ? std::stoull(argv[1]) : DefaultCalls;
+
+    std::vector<GBenchResult> results;
+    for (const Size count : SubscriberCounts) {
+        measureBroadcasts(results, calls, count);
+    }
+    printResults(results);
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_tools.hpp"
+#include "g_log_file_sink.hpp"
+#include "g_logger.hpp"
+
+/**
+ * Measures the cost of the GLOG_* macros in a number of scenarios and prints ns/call and allocations/call.
+ *
+ * Usage: bench_logger [calls per scenario and thread]
+ */
+
+using namespace gbase;
+using namespace gbase::bench;
+
+namespace {
+
+constexpr Size DefaultCalls = 1'000'000;
+
+/**
+ * @brief Runs a scenario on one thread and on several threads.
+ */
+template <typename Body>
+void measureContention(std::vector<GBenchResult> &results, const String &name, Size calls, Size threads,
+                       Body body) {
+    GLogger &logger = GLogger::getInstance();
+    results.push_back(measure(name, calls, 1, body, [&logger] { logger.flush(); }));
+    results.push_back(measure(name, calls, threads, body, [&logger] { logger.flush(); }));
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const Size calls = argc > 1 ? std::stoull(argv[1]) : DefaultCalls;
+    const Size threads = std::clamp<Size>(std::thread::hardware_concurrency(), 2, 8);
+    const GPath directory = std::filesystem::temp_directory_path() / "gbase_bench_logger";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    GLogger &logger = GLogger::getInstance();
+    const auto nullSink = std::make_shared<GNullLogSink>();
+    logger.removeSink(logger.consoleSink());
+    logger.addSink(nullSink);
+
+    std::vector<GBenchResult> results;
+    const auto logInfo = [](Size i) { GLOG_INFO("Value: ", i, " of ", 42); };
+
+    logger.setLogLevel(GLogger::LogLevel::None);
+    results.push_back(measure("Disabled level", calls, 1, logInfo));
+    logger.setLogLevel(GLogger::LogLevel::Normal);
+    results.push_back(measure("Disabled details", calls, 1, [](Size i) { GLOG_DETAILS("Value: ", i); }));
+
+    {
+        GLocalLogFilter filter({"no such trigger"});
+        results.push_back(measure("Filtered out, message scope", calls, 1, logInfo));
+        logger.setFilterScope(GLogger::FilterScope::Context);
+        results.push_back(measure("Filtered out, context scope", calls, 1, logInfo));
+        logger.setFilterScope(GLogger::FilterScope::Message);
+    }
+
+    measureContention(results, "Null sink, concat", calls, threads, logInfo);
+    measureContention(results, "Null sink, format", calls, threads,
+                      [](Size i) { GLOG_INFO_FMT("Value: {} of {}", i, 42); });
+    measureContention(results, "Null sink, every 100th", calls, threads,
+                      [](Size i) { GLOG_INFO_EVERY_N(100, "Value: ", i, " of ", 42); });
+
+    logger.showTimestamp(false);
+    results.push_back(measure("Null sink, no timestamp", calls, 1, logInfo));
+    logger.showTimestamp(true);
+
+    logger.enableAsync();
+    measureContention(results, "Null sink, async", calls, threads, logInfo);
+    logger.disableAsync();
+
+    const GLogFileOptions fileOptions{.basePath = directory / "bench", .maxSegments = 2};
+    const auto fileSink = std::make_shared<GMappedFileLogSink>(fileOptions);
+    logger.removeSink(nullSink);
+    logger.addSink(fileSink);
+    measureContention(results, "Mapped file sink", calls, threads, logInfo);
+    logger.enableAsync();
+    measureContention(results, "Mapped file sink, async", calls, threads, logInfo);
+    logger.disableAsync();
+    logger.removeSink(fileSink);
+
+    logger.enableBinaryOutput(directory / "bench.glog");
+    measureContention(results, "Binary output", calls, threads, logInfo);
+    logger.disableBinaryOutput();
+
+    logger.addSink(logger.consoleSink());
+    printResults(results);
+
+    std::filesystem::remove_all(directory);
+    return 0;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <latch>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "g_basic_types.hpp"
+
+namespace gbase::bench {
+
+/**
+ * @brief Gives the number of calls to the global operator new so far. Defined in bench_allocator.cpp, which
+ * must be linked into each benchmark executable.
+ */
+Size allocationCount();
+
+/**
+ * @brief The outcome of one benchmark scenario.
+ */
+struct GBenchResult {
+    String name;
+    Size threads{1};
+    double nanosecondsPerCall{0};
+    double allocationsPerCall{0};
+};
+
+/**
+ * @brief Calls body(i) for i in [0, calls) on each of the given number of threads, and then finish() once.
+ *
+ * Every thread first makes a number of warm-up calls, so one time initialization like thread_local buffers
+ * is not measured. The time per call is the wall time divided by the calls of one thread, i.e. what a call
+ * costs each thread while the other threads run the same code.
+ */
+template <typename Body, typename Finish>
+GBenchResult measure(std::string_view name, Size calls, Size threads, Body &&body, Finish &&finish) {
+    const Size warmUpCalls = std::min<Size>(calls, 1000);
+    std::latch ready{static_cast<std::ptrdiff_t>(threads)};
+    std::latch go{1};
+
+    const auto run = [&] {
+        for (Size i = 0; i < warmUpCalls; ++i) {
+            body(i);
+        }
+        ready.count_down();
+        go.wait();
+        for (Size i = 0; i < calls; ++i) {
+            body(i);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (Size t = 0; t < threads; ++t) {
+        workers.emplace_back(run);
+    }
+
+    ready.wait();
+    const Size allocationsBefore = allocationCount();
+    const auto start = std::chrono::steady_clock::now();
+    go.count_down();
+
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    finish();
+
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    const Size allocations = allocationCount() - allocationsBefore;
+
+    return {String{name}, threads, elapsed.count() / static_cast<double>(calls),
+            static_cast<double>(allocations) / static_cast<double>(calls * threads)};
+}
+
+template <typename Body> GBenchResult measure(std::string_view name, Size calls, Size threads, Body &&body) {
+    return measure(name, calls, threads, std::forward<Body>(body), [] {});
+}
+
+/**
+ * @brief Prints the results as a table to std::cout.
+ */
+inline void printResults(const std::vector<GBenchResult> &results) {
+    std::cout << std::format("{:<56}{:>8}{:>14}{:>14}\n", "Scenario", "Threads", "ns/call", "allocs/call");
+    for (const auto &result : results) {
+        std::cout << std::format("{:<56}{:>8}{:>14.1f}{:>14.3f}\n", result.name, result.threads,
+                                 result.nanosecondsPerCall, result.allocationsPerCall);
+    }
+}
+
+} // namespace gbase::bench
@@ -5,6 +5,7 @@ param (
     [switch]$compile,
     [switch]$help,
     [switch]$test,
+    [switch]$bench,
     [switch]$app,
     [switch]$doc,
     [switch]$release,
@@ -20,6 +21,7 @@ function Show-Help {
     Write-Host "  -rebuild    Rebuild the build directory."
     Write-Host "  -compile    Compile the project."
     Write-Host "  -test       Run the tests."
+    Write-Host "  -bench      Run the benchmarks."
     Write-Host "  -app        Run the application."
     Write-Host "  -doc        Generate Doxygen documentaion."
     Write-Host "  -release    Build release project."
@@ -111,6 +113,13 @@ function Test {
     ./builddir/run_tests.exe
 }
 
+# Function to run the benchmarks
+function Bench {
+    Write-Host "Running the benchmarks..."
+    ./builddir/bench_logger.exe
+    ./builddir/bench_connections.exe
+}
+
 # Function to run the application
 function App {
     Write-Host "Running the application..."
@@ -151,6 +160,10 @@ if ($test) {
     Test
 }
 
+if ($bench) {
+    Bench
+}
+
 if ($app) {
     App
 }
@@ -161,7 +174,7 @@ if ($doc) {
 
 
 # Default action if no flags are provided
-if (-not ($clean -or $rebuild -or $compile -or $test -or $doc -or $wipe)) {
+if (-not ($clean -or $rebuild -or $compile -or $test -or $bench -or $doc -or $wipe)) {
     Write-Host "No flags provided."
     Show-Help
 }
\ No newline at end of file
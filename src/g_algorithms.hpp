@@ -8,6 +8,7 @@
 #include "g_basic_types.hpp"
 #include "g_exceptions.hpp"
 #include "g_set.hpp"
+#include "g_small_vector.hpp"
 #include "g_vector.hpp"
 
 namespace gbase {
@@ -43,7 +44,7 @@ template <std::ranges::range Range> constexpr auto combinations(const Range &inp
     }
 
     GVector<GSet<ValueType>> result;
-    GVector<Size> indices(subsequenceLength);
+    GSmallVector<Size, 8> indices(subsequenceLength);
 
     // Initialize indices to [0, 1, 2, ..., subsequenceLength-1]
     std::iota(indices.begin(), indices.end(), 0);
@@ -7,6 +7,20 @@
 #include <string>
 #include <type_traits>
 
+/**
+ * @def GBASE_CHECKED_ACCESS
+ * @brief 1 if operator[] of GVector and GSmallVector checks the index and raises GOutOfRange, 0 if it
+ * indexes the elements directly. Defaults to checked access in debug builds and unchecked access when NDEBUG
+ * is defined. Set by the meson option 'checked_access'.
+ */
+#ifndef GBASE_CHECKED_ACCESS
+#ifdef NDEBUG
+#define GBASE_CHECKED_ACCESS 0
+#else
+#define GBASE_CHECKED_ACCESS 1
+#endif
+#endif
+
 namespace gbase {
 
 using Unsigned = unsigned;
@@ -19,6 +33,11 @@ using String = std::string;
 constexpr Integer integerMax = std::numeric_limits<int>::max();
 constexpr Integer integerMin = std::numeric_limits<int>::min();
 
+/**
+ * @brief Tells if operator[] of the containers checks the index, see GBASE_CHECKED_ACCESS.
+ */
+constexpr bool CheckedAccess = GBASE_CHECKED_ACCESS != 0;
+
 template <typename Range, typename Type>
 concept RangeOf = std::ranges::range<Range> && std::same_as<std::ranges::range_value_t<Range>, Type>;
 
@@ -1,6 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <bit>
+#include <cstdint>
 #include <iterator>
+#include <memory>
+
+#include "g_basic_types.hpp"
 
 namespace gbase {
 
@@ -35,4 +41,133 @@ template <typename Container> class GCircularVectorIterator {
     Iterator end_;
 };
 
-} // namespace gbase
\ No newline at end of file
+constexpr Size CacheLineSize = 64;
+
+/**
+ * @brief Bounded lock-free queue which can be used by multiple producers and multiple consumers.
+ *
+ * Each slot carries a sequence number which tells producers and consumers if the slot is free or filled,
+ * so pushing and popping only needs one compare-and-swap on the shared position in the common case.
+ *
+ * @tparam Type Must be default constructible and move assignable.
+ */
+template <typename Type> class GRingBuffer {
+  public:
+    /**
+     * @param capacity The maximum number of elements. It is rounded up to the next power of two.
+     */
+    explicit GRingBuffer(Size capacity)
+        : capacity_{std::bit_ceil(capacity < 2 ? Size{2} : capacity)}, mask_{capacity_ - 1},
+          cells_{std::make_unique<Cell[]>(capacity_)} {
+        for (Size i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    GRingBuffer(const GRingBuffer &) = delete;
+    GRingBuffer &operator=(const GRingBuffer &) = delete;
+
+    ~GRingBuffer() = default;
+
+    /**
+     * @brief Moves the value into the buffer.
+     * @return False if the buffer is full, in which case the value is left untouched.
+     */
+    bool tryPush(Type &&value) {
+        Size pos{0};
+        Cell *cell = claim(enqueuePos_, 0, pos);
+        if (cell == nullptr) {
+            return false;
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Copies the value into the buffer.
+     * @return False if the buffer is full.
+     */
+    bool tryPush(const Type &value) {
+        Type copy{value};
+        return tryPush(std::move(copy));
+    }
+
+    /**
+     * @brief Moves the oldest value in the buffer into the given value.
+     * @return False if the buffer is empty.
+     */
+    bool tryPop(Type &value) {
+        Size pos{0};
+        Cell *cell = claim(dequeuePos_, 1, pos);
+        if (cell == nullptr) {
+            return false;
+        }
+        value = std::move(cell->value);
+        cell->sequence.store(pos + capacity_, std::memory_order_release);
+        return true;
+    }
+
+    constexpr Size capacity() const { return capacity_; }
+
+    /**
+     * @brief Gives the number of values pushed so far, including pushes which are still storing their value.
+     * Each push takes the next position, so the value is also the position of the next push.
+     */
+    Size pushCount() const { return enqueuePos_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Gives the number of values popped so far, including pops which are still taking their value.
+     * Values are popped in the order of their positions.
+     */
+    Size popCount() const { return dequeuePos_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Gives the number of elements in the buffer. The value is only a snapshot when other threads
+     * push or pop concurrently.
+     */
+    Size sizeApprox() const {
+        const Size enqueued = enqueuePos_.load(std::memory_order_relaxed);
+        const Size dequeued = dequeuePos_.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+  private:
+    struct Cell {
+        std::atomic<Size> sequence{0};
+        Type value{};
+    };
+
+    /**
+     * @brief Claims the cell at given position when its sequence number says it is ready for the caller.
+     *
+     * @param lag 0 when claiming for a push and 1 when claiming for a pop.
+     * @param pos Receives the claimed position.
+     */
+    Cell *claim(std::atomic<Size> &position, Size lag, Size &pos) {
+        pos = position.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell &cell = cells_[pos & mask_];
+            const Size sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + lag);
+
+            if (diff == 0) {
+                if (position.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return &cell;
+                }
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    alignas(CacheLineSize) std::atomic<Size> enqueuePos_{0};
+    alignas(CacheLineSize) std::atomic<Size> dequeuePos_{0};
+    alignas(CacheLineSize) const Size capacity_;
+    const Size mask_;
+    std::unique_ptr<Cell[]> cells_;
+};
+
+} // namespace gbase
@@ -1,10 +1,21 @@
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
-#include <unordered_map>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include "g_basic_types.hpp"
+#include "g_inplace_function.hpp"
+#include "g_mailbox.hpp"
+#include "g_snapshot.hpp"
 
 namespace gbase {
 
@@ -30,220 +41,541 @@ using CallbackFuncNoParameter = std::function<CallbackSigNoParameter<SubjectType
 template <typename SubjectType, typename CallbackType>
 using CallbackFuncOneParameter = std::function<CallbackSigOneParameter<SubjectType, CallbackType>>;
 
+template <typename SubjectType>
+using CallbackSlotNoParameter = GInplaceFunction<CallbackSigNoParameter<SubjectType>>;
+
+template <typename SubjectType, typename CallbackType>
+using CallbackSlotOneParameter = GInplaceFunction<CallbackSigOneParameter<SubjectType, CallbackType>>;
+
 /**
- * @brief
+ * @brief Tells how notifications of a queued connection are posted to the mailbox of the receiver.
+ */
+enum class GCoalescing {
+    None,  ///< Each notification is delivered.
+    Latest ///< A pending notification for the same subject is replaced, so only the latest is delivered.
+};
+
+/**
+ * @brief Identifies one connection of a signal. A handle stays valid until the connection is removed, and a
+ * handle of a removed connection is detected even if its storage has been reused by another connection.
+ */
+struct GConnectionHandle {
+    static constexpr Unsigned InvalidIndex = std::numeric_limits<Unsigned>::max();
+
+    Unsigned index{InvalidIndex};
+    Unsigned generation{0};
+
+    bool isValid() const { return index != InvalidIndex; }
+
+    bool operator==(const GConnectionHandle &) const = default;
+};
+
+/**
+ * @brief Flat storage of the connections of a signal. The callbacks are kept in contiguous arrays, and the
+ * connected instances in a parallel array with the same positions, so notifying all connections is a linear
+ * scan without any hash lookups or heap indirections.
+ *
+ * Each connection has either a callback or a batch callback. A GConnectionHandle indexes a slot table which
+ * holds the position of the connection in the arrays, so finding a connection by its handle does not search.
+ * An instance may have any number of connections.
  *
+ * The order of the connections is not preserved when a connection is removed.
  */
-template <typename SubjectType> class G0PConnector {
+template <typename Signature, typename BatchSignature> class GConnectionList {
   public:
-    G0PConnector() = default;
-    ~G0PConnector() = default;
-
-    void connect(GConnectable *instance, CallbackFuncNoParameter<SubjectType> callback) {
-        callbacks_[instance] = std::move(callback);
+    using Callback = GInplaceFunction<Signature>;
+    using BatchCallback = GInplaceFunction<BatchSignature>;
+
+    GConnectionHandle connect(GConnectable *instance, Callback callback,
+                              BatchCallback batchCallback = nullptr) {
+        GConnectionHandle handle;
+        if (freeSlots_.empty()) {
+            handle.index = static_cast<Unsigned>(slots_.size());
+            slots_.push_back({});
+        } else {
+            handle.index = freeSlots_.back();
+            freeSlots_.pop_back();
+        }
+        Slot &slot = slots_[handle.index];
+        slot.position = static_cast<Unsigned>(instances_.size());
+        handle.generation = slot.generation;
+
+        instances_.push_back(instance);
+        callbacks_.push_back(std::move(callback));
+        batchCallbacks_.push_back(std::move(batchCallback));
+        slotIndices_.push_back(handle.index);
+        return handle;
     }
 
-    void disconnect(GConnectable *instance) { callbacks_.erase(instance); }
-
-    void notify(SubjectType *subject, GConnectable *instance) const {
-        auto it = callbacks_.find(instance);
-        if (it != callbacks_.end() && it->second) {
-            it->second(subject);
+    /**
+     * @brief Removes the connection. Returns false if the handle does not refer to a connection.
+     */
+    bool disconnect(GConnectionHandle handle) {
+        const auto position = find(handle);
+        if (!position) {
+            return false;
         }
+        remove(*position);
+        return true;
     }
 
-    void notify(SubjectType *subject) const {
-        for (const auto &entry : callbacks_) {
-            if (entry.second) {
-                entry.second(subject);
+    /**
+     * @brief Removes all connections of the instance and returns their number.
+     */
+    Size disconnect(GConnectable *instance) {
+        Size removed{0};
+        for (Size position = instances_.size(); position-- > 0;) {
+            if (instances_[position] == instance) {
+                remove(position);
+                ++removed;
             }
         }
+        return removed;
     }
 
-    Size connectionCount() const { return callbacks_.size(); }
-
-    bool isConnected(GConnectable *instance) const { return callbacks_.find(instance) != callbacks_.end(); }
-
-  private:
-    std::unordered_map<GConnectable *, CallbackFuncNoParameter<SubjectType>> callbacks_;
-};
+    /**
+     * @brief Gives the position of the connection in callbacks() and batchCallbacks().
+     */
+    std::optional<Size> find(GConnectionHandle handle) const {
+        if (handle.index >= slots_.size()) {
+            return std::nullopt;
+        }
+        const Slot &slot = slots_[handle.index];
+        if (slot.generation != handle.generation || slot.position == GConnectionHandle::InvalidIndex) {
+            return std::nullopt;
+        }
+        return slot.position;
+    }
 
-/**
- * @brief
- *
- */
-template <typename SubjectType, typename CallbackType> class G1PConnector {
-  public:
-    G1PConnector() = default;
-    ~G1PConnector() = default;
+    const std::vector<Callback> &callbacks() const { return callbacks_; }
+    const std::vector<BatchCallback> &batchCallbacks() const { return batchCallbacks_; }
 
-    void connect(GConnectable *instance, CallbackFuncOneParameter<SubjectType, CallbackType> callback) {
-        callbacks_[instance] = std::move(callback);
+    /**
+     * @brief Calls the function with the position of each connection of the instance.
+     */
+    template <typename Function> void forEachOf(GConnectable *instance, Function &&function) const {
+        for (Size position = 0; position < instances_.size(); ++position) {
+            if (instances_[position] == instance) {
+                function(position);
+            }
+        }
     }
 
-    void disconnect(GConnectable *instance) { callbacks_.erase(instance); }
+    /**
+     * @brief Calls all connected callbacks with the given arguments.
+     */
+    template <typename... Args> void notifyAll(const Args &...args) const {
+        forEach(callbacks_, [&](const Callback &callback) { callback(args...); });
+    }
 
-    void notify(SubjectType *subject, GConnectable *instance,
-                CallbackParam<CallbackType> callbackParam) const {
-        auto it = callbacks_.find(instance);
-        if (it != callbacks_.end() && it->second) {
-            it->second(subject, callbackParam);
-        }
+    /**
+     * @brief Calls all connected batch callbacks with the given arguments.
+     */
+    template <typename... Args> void notifyAllBatches(const Args &...args) const {
+        forEach(batchCallbacks_, [&](const BatchCallback &callback) { callback(args...); });
     }
 
-    void notify(SubjectType *subject, CallbackParam<CallbackType> callbackParam) const {
-        for (const auto &entry : callbacks_) {
-            if (entry.second) {
-                entry.second(subject, callbackParam);
+    /**
+     * @brief Calls the function for each callback of the array which is not empty.
+     */
+    template <typename Callbacks, typename Function>
+    static void forEach(const Callbacks &callbacks, Function &&function) {
+        for (const auto &callback : callbacks) {
+            if (callback) {
+                function(callback);
             }
         }
     }
 
-    Size connectionCount() const { return callbacks_.size(); }
+    Size size() const { return instances_.size(); }
 
-    bool isConnected(GConnectable *instance) const { return callbacks_.find(instance) != callbacks_.end(); }
+    bool contains(GConnectable *instance) const {
+        return std::ranges::find(instances_, instance) != instances_.end();
+    }
+
+    bool contains(GConnectionHandle handle) const { return find(handle).has_value(); }
 
   private:
-    std::unordered_map<GConnectable *, CallbackFuncOneParameter<SubjectType, CallbackType>> callbacks_;
+    struct Slot {
+        Unsigned position{GConnectionHandle::InvalidIndex};
+        Unsigned generation{0};
+    };
+
+    void remove(Size position) {
+        Slot &slot = slots_[slotIndices_[position]];
+        slot.position = GConnectionHandle::InvalidIndex;
+        ++slot.generation;
+        freeSlots_.push_back(slotIndices_[position]);
+
+        const Size last = instances_.size() - 1;
+        if (position != last) {
+            instances_[position] = instances_[last];
+            callbacks_[position] = std::move(callbacks_[last]);
+            batchCallbacks_[position] = std::move(batchCallbacks_[last]);
+            slotIndices_[position] = slotIndices_[last];
+            slots_[slotIndices_[position]].position = static_cast<Unsigned>(position);
+        }
+        instances_.pop_back();
+        callbacks_.pop_back();
+        batchCallbacks_.pop_back();
+        slotIndices_.pop_back();
+    }
+
+    std::vector<GConnectable *> instances_;
+    std::vector<Callback> callbacks_;
+    std::vector<BatchCallback> batchCallbacks_;
+    std::vector<Unsigned> slotIndices_;
+    std::vector<Slot> slots_;
+    std::vector<Unsigned> freeSlots_;
 };
 
 /**
- * @brief
+ * @brief Tells the event type of batch notifications, which only signals with exactly one parameter support.
+ */
+template <typename... Args> struct GBatchEvent {
+    static constexpr bool Supported = false;
+    using Type = std::monostate;
+};
+
+template <typename Arg> struct GBatchEvent<Arg> {
+    static constexpr bool Supported = true;
+    using Type = Arg;
+};
+
+/**
+ * @brief Calls the connected callbacks with the subject and any number of parameters, which are passed by
+ * const reference.
+ *
+ * Callbacks are stored in a GInplaceFunction, so a member function bound with connect<&Type::member>() or a
+ * lambda capturing a few pointers is stored without allocating, and calling it is a single indirect call.
+ * Larger callables are moved to the heap when they are connected.
+ *
+ * The signal is thread-safe. notify() calls the callbacks of an immutable snapshot of the connections without
+ * locking, and connect() and disconnect() publish a modified copy, see GSnapshotCell. A callback may connect
+ * or disconnect, including itself, while it is notified. When disconnect() returns, the callback is not
+ * running on any other thread and will not be called again, so the connected instance can be destroyed.
+ * A disconnect() from inside a callback only ensures that the callback is not called again if another thread
+ * connects or disconnects at the same time. A callback must not wait for a thread which disconnects from the
+ * same signal. This does not cover queued connections, see connectQueued(): tasks which notify() has already
+ * posted to the mailbox still run after disconnect(), so the receiver must also close() or drain its mailbox
+ * before the instance is destroyed.
+ *
+ * A signal with one parameter also delivers whole batches of events with notifyBatch(). A batch slot,
+ * connected with connectBatch(), gets the batch in one call, and a single notify() reaches it as a batch of
+ * one event. Ordinary slots are called once per event of a batch.
  *
+ * Example usage:
+ * @code
+ * GSignal<Document, Integer, String> lineChanged;
+ * lineChanged.connect<&View::onLineChanged>(&view);
+ * lineChanged.notify(&document, 12, "text");
+ * @endcode
  */
-template <typename SubjectType> class G0PAutoConnection {
+template <typename SubjectType, typename... Args> class GSignal {
   public:
-    G0PAutoConnection() : connector_{nullptr}, instance_{nullptr} {}
+    using Signature = void(SubjectType *, CallbackParam<Args>...);
+    using Slot = GInplaceFunction<Signature>;
+
+    static constexpr bool BatchSupported = GBatchEvent<Args...>::Supported;
+    using Event = typename GBatchEvent<Args...>::Type;
+    using BatchSignature = void(SubjectType *, std::span<const Event>);
+    using BatchSlot = GInplaceFunction<BatchSignature>;
+
+    GSignal() = default;
+    ~GSignal() = default;
+
+    /**
+     * @brief Adds a connection of the instance. An instance may be connected several times.
+     */
+    GConnectionHandle connect(GConnectable *instance, Slot callback) {
+        GConnectionHandle handle;
+        connections_.update(
+            [&](Connections &connections) { handle = connections.connect(instance, std::move(callback)); });
+        return handle;
+    }
 
-    // Constructor for lambdas or general callable objects
-    template <typename Callable>
-    G0PAutoConnection(G0PConnector<SubjectType> &connector, GConnectable *instance, Callable &&callback)
-        : connector_{&connector}, instance_{instance} {
-        connector_->connect(
-            instance, std::function<CallbackSigNoParameter<SubjectType>>(std::forward<Callable>(callback)));
+    /**
+     * @brief Connects a member function which is bound at compile time, so the callback only stores the
+     * instance pointer and calls the member function directly.
+     */
+    template <auto MemberFunc, typename InstanceType> GConnectionHandle connect(InstanceType *instance) {
+        return connect(instance, [instance](SubjectType *subject, CallbackParam<Args>... args) {
+            (instance->*MemberFunc)(subject, args...);
+        });
     }
 
-    // Constructor for member function pointers
-    template <typename InstanceType>
-    G0PAutoConnection(G0PConnector<SubjectType> &connector, GConnectable *instance,
-                      void (InstanceType::*memberFunc)(SubjectType *))
-        : connector_{&connector}, instance_{instance} {
+    /**
+     * @brief Connects the instance so that notify() does not call the callback directly, but posts the
+     * subject and a copy of the parameters to the mailbox of the receiver. The callback then runs when the
+     * mailbox is drained, e.g. by the event loop of the receiver or by a GMailboxPool. Tasks posted before
+     * disconnect() still call the callback, so the receiver closes its mailbox before it is destroyed.
+     */
+    GConnectionHandle connectQueued(GConnectable *instance, GMailbox &mailbox, Slot callback,
+                                    GCoalescing coalescing = GCoalescing::None) {
+        auto slot = std::make_shared<const Slot>(std::move(callback));
+        return connect(instance, QueuedCallback{&mailbox, std::move(slot), coalescing});
+    }
 
-        connect(connector, instance, memberFunc);
+    /**
+     * @brief Adds a connection with a slot which receives the events of notifyBatch() in one call.
+     */
+    GConnectionHandle connectBatch(GConnectable *instance, BatchSlot callback)
+        requires BatchSupported
+    {
+        GConnectionHandle handle;
+        connections_.update([&](Connections &connections) {
+            handle = connections.connect(instance, nullptr, std::move(callback));
+        });
+        return handle;
     }
 
-    ~G0PAutoConnection() noexcept { disconnect(); }
+    /**
+     * @brief Connects a batch member function which is bound at compile time.
+     */
+    template <auto MemberFunc, typename InstanceType>
+        requires BatchSupported
+    GConnectionHandle connectBatch(InstanceType *instance) {
+        return connectBatch(instance, [instance](SubjectType *subject, std::span<const Event> events) {
+            (instance->*MemberFunc)(subject, events);
+        });
+    }
 
-    G0PAutoConnection(G0PAutoConnection &&other) noexcept
-        : connector_(other.connector_), instance_(other.instance_) {
-        other.connector_ = nullptr;
-        other.instance_ = nullptr;
+    /**
+     * @brief Removes the connection. A handle of a removed connection is ignored.
+     */
+    void disconnect(GConnectionHandle handle) {
+        if (connections_.read()->contains(handle)) {
+            connections_.update([handle](Connections &connections) { connections.disconnect(handle); });
+        }
     }
 
-    G0PAutoConnection &operator=(G0PAutoConnection &&other) noexcept {
-        if (this != &other) {
-            disconnect();
-            connector_ = other.connector_;
-            instance_ = other.instance_;
-            other.connector_ = nullptr;
-            other.instance_ = nullptr;
+    /**
+     * @brief Removes all connections of the instance.
+     */
+    void disconnect(GConnectable *instance) {
+        if (connections_.read()->contains(instance)) {
+            connections_.update([instance](Connections &connections) { connections.disconnect(instance); });
         }
-        return *this;
     }
 
-    void disconnect() {
-        if (connector_ && instance_) {
-            connector_->disconnect(instance_);
+    /**
+     * @brief Calls the callback of the connection only.
+     */
+    void notify(SubjectType *subject, GConnectionHandle handle, CallbackParam<Args>... args) const {
+        const auto connections = connections_.read();
+        if (const auto position = connections->find(handle)) {
+            notifyAt(*connections, *position, subject, args...);
         }
-        connector_ = nullptr;
-        instance_ = nullptr;
     }
 
-    template <typename InstanceType>
-    void connect(G0PConnector<SubjectType> &connector, GConnectable *instance,
-                 void (InstanceType::*memberFunc)(SubjectType *)) {
+    /**
+     * @brief Calls the callbacks of the connections of the instance only.
+     */
+    void notify(SubjectType *subject, GConnectable *instance, CallbackParam<Args>... args) const {
+        const auto connections = connections_.read();
+        connections->forEachOf(
+            instance, [&](Size position) { notifyAt(*connections, position, subject, args...); });
+    }
 
-        connector_ = &connector;
-        instance_ = instance;
+    void notify(SubjectType *subject, CallbackParam<Args>... args) const {
+        const auto connections = connections_.read();
+        connections->notifyAll(subject, args...);
+        if constexpr (BatchSupported) {
+            const std::span<const Event> events{std::addressof(args)..., 1};
+            connections->notifyAllBatches(subject, events);
+        }
+    }
 
-        connector_->connect(instance, [instance = static_cast<InstanceType *>(instance), memberFunc](
-                                          SubjectType *subject) { (instance->*memberFunc)(subject); });
+    /**
+     * @brief Notifies all connections about the events, in order. Batch slots are called once with all
+     * events, other slots once per event.
+     */
+    void notifyBatch(SubjectType *subject, std::span<const Event> events) const
+        requires BatchSupported
+    {
+        if (events.empty()) {
+            return;
+        }
+        const auto connections = connections_.read();
+        connections->notifyAllBatches(subject, events);
+        Connections::forEach(connections->callbacks(), [subject, events](const Slot &callback) {
+            for (const auto &event : events) {
+                callback(subject, event);
+            }
+        });
     }
 
+    Size connectionCount() const { return connections_.read()->size(); }
+
+    bool isConnected(GConnectable *instance) const { return connections_.read()->contains(instance); }
+
+    bool isConnected(GConnectionHandle handle) const { return connections_.read()->contains(handle); }
+
   private:
-    G0PConnector<SubjectType> *connector_{nullptr};
-    GConnectable *instance_{nullptr};
+    /**
+     * @brief The callback of a queued connection, which posts the notification to the mailbox.
+     */
+    struct QueuedCallback {
+        void operator()(SubjectType *subject, CallbackParam<Args>... args) const {
+            std::optional<GMailbox::Key> key;
+            if (coalescing == GCoalescing::Latest) {
+                key = GMailbox::Key{slot.get(), subject};
+            }
+            mailbox->post(
+                [slot = slot, subject, values = std::tuple<Args...>{args...}] {
+                    std::apply([&](const auto &...params) { (*slot)(subject, params...); }, values);
+                },
+                key);
+        }
+
+        GMailbox *mailbox;
+        std::shared_ptr<const Slot> slot;
+        GCoalescing coalescing;
+    };
+
+    using Connections = GConnectionList<Signature, BatchSignature>;
+
+    static void notifyAt(const Connections &connections, Size position, SubjectType *subject,
+                         CallbackParam<Args>... args) {
+        if (const auto &callback = connections.callbacks()[position]) {
+            callback(subject, args...);
+        }
+        if constexpr (BatchSupported) {
+            if (const auto &callback = connections.batchCallbacks()[position]) {
+                callback(subject, std::span<const Event>{std::addressof(args)..., 1});
+            }
+        }
+    }
+
+    GSnapshotCell<Connections> connections_;
 };
 
 /**
- * @brief
- *
+ * @brief Calls the connected callbacks without parameters.
+ */
+template <typename SubjectType> using G0PConnector = GSignal<SubjectType>;
+
+/**
+ * @brief Calls the connected callbacks with one parameter.
+ */
+template <typename SubjectType, typename CallbackType>
+using G1PConnector = GSignal<SubjectType, CallbackType>;
+
+/**
+ * @brief Holds one connection to a GSignal and disconnects it when destroyed or when another connection is
+ * made. May be destroyed on another thread than the one notifying the signal: the destructor waits until the
+ * callback is not running on other threads.
  */
-template <typename SubjectType, typename CallbackType> class G1PAutoConnection {
+template <typename SubjectType, typename... Args> class GAutoConnection {
   public:
-    G1PAutoConnection() : connector_{nullptr}, instance_{nullptr} {}
+    using Signal = GSignal<SubjectType, Args...>;
+
+    GAutoConnection() = default;
 
     // Constructor for lambdas or general callable objects
     template <typename Callable>
-    G1PAutoConnection(G1PConnector<SubjectType, CallbackType> &connector, GConnectable *instance,
-                      Callable &&callback)
-        : connector_{&connector}, instance_{instance} {
-        connector_->connect(instance, std::function<CallbackSigOneParameter<SubjectType, CallbackType>>(
-                                          std::forward<Callable>(callback)));
-    }
+    GAutoConnection(Signal &signal, GConnectable *instance, Callable &&callback)
+        : signal_{&signal},
+          handle_{signal.connect(instance, typename Signal::Slot(std::forward<Callable>(callback)))} {}
 
     // Constructor for member function pointers
     template <typename InstanceType>
-    G1PAutoConnection(G1PConnector<SubjectType, CallbackType> &connector, GConnectable *instance,
-                      void (InstanceType::*memberFunc)(SubjectType *, CallbackParam<CallbackType>))
-        : connector_{&connector}, instance_{instance} {
-
-        connect(connector, instance, memberFunc);
+    GAutoConnection(Signal &signal, GConnectable *instance,
+                    void (InstanceType::*memberFunc)(SubjectType *, CallbackParam<Args>...)) {
+        connect(signal, instance, memberFunc);
     }
 
-    ~G1PAutoConnection() noexcept { disconnect(); }
+    ~GAutoConnection() noexcept { disconnect(); }
 
-    G1PAutoConnection(G1PAutoConnection &&other) noexcept
-        : connector_(other.connector_), instance_(other.instance_) {
-        other.connector_ = nullptr;
-        other.instance_ = nullptr;
-    }
+    GAutoConnection(GAutoConnection &&other) noexcept
+        : signal_{std::exchange(other.signal_, nullptr)}, handle_{std::exchange(other.handle_, {})} {}
 
-    G1PAutoConnection &operator=(G1PAutoConnection &&other) noexcept {
+    GAutoConnection &operator=(GAutoConnection &&other) noexcept {
         if (this != &other) {
             disconnect();
-            connector_ = other.connector_;
-            instance_ = other.instance_;
-            other.connector_ = nullptr;
-            other.instance_ = nullptr;
+            signal_ = std::exchange(other.signal_, nullptr);
+            handle_ = std::exchange(other.handle_, {});
         }
         return *this;
     }
 
     void disconnect() {
-        if (connector_ && instance_) {
-            connector_->disconnect(instance_);
+        if (signal_ && handle_.isValid()) {
+            signal_->disconnect(handle_);
         }
-        connector_ = nullptr;
-        instance_ = nullptr;
+        signal_ = nullptr;
+        handle_ = {};
     }
 
     template <typename InstanceType>
-    void connect(G1PConnector<SubjectType, CallbackType> &connector, GConnectable *instance,
-                 void (InstanceType::*memberFunc)(SubjectType *, CallbackParam<CallbackType>)) {
+    void connect(Signal &signal, GConnectable *instance,
+                 void (InstanceType::*memberFunc)(SubjectType *, CallbackParam<Args>...)) {
+        disconnect();
+        signal_ = &signal;
+        handle_ = signal_->connect(instance, [instance = static_cast<InstanceType *>(instance),
+                                              memberFunc](SubjectType *subject, CallbackParam<Args>... args) {
+            (instance->*memberFunc)(subject, args...);
+        });
+    }
 
-        connector_ = &connector;
-        instance_ = instance;
+    /**
+     * @brief Connects a member function which is bound at compile time, see GSignal::connect().
+     */
+    template <auto MemberFunc, typename InstanceType> void connect(Signal &signal, InstanceType *instance) {
+        disconnect();
+        signal_ = &signal;
+        handle_ = signal_->template connect<MemberFunc>(instance);
+    }
 
-        connector_->connect(instance, [instance = static_cast<InstanceType *>(instance),
-                                       memberFunc](SubjectType *subject, CallbackParam<CallbackType> param) {
-            (instance->*memberFunc)(subject, param);
-        });
+    /**
+     * @brief Connects a batch slot, see GSignal::connectBatch().
+     */
+    template <typename Callable>
+        requires Signal::BatchSupported
+    void connectBatch(Signal &signal, GConnectable *instance, Callable &&callback) {
+        disconnect();
+        signal_ = &signal;
+        handle_ =
+            signal_->connectBatch(instance, typename Signal::BatchSlot(std::forward<Callable>(callback)));
     }
 
+    /**
+     * @brief Connects the member function as a queued connection, see GSignal::connectQueued().
+     */
+    template <typename InstanceType>
+    void connectQueued(Signal &signal, GConnectable *instance, GMailbox &mailbox,
+                       void (InstanceType::*memberFunc)(SubjectType *, CallbackParam<Args>...),
+                       GCoalescing coalescing = GCoalescing::None) {
+        auto callback = [instance = static_cast<InstanceType *>(instance),
+                         memberFunc](SubjectType *subject, CallbackParam<Args>... args) {
+            (instance->*memberFunc)(subject, args...);
+        };
+        disconnect();
+        signal_ = &signal;
+        handle_ = signal_->connectQueued(instance, mailbox, std::move(callback), coalescing);
+    }
+
+    /**
+     * @brief Gives the handle of the connection, which is invalid if not connected.
+     */
+    GConnectionHandle handle() const { return handle_; }
+
+    bool isConnected() const { return signal_ && signal_->isConnected(handle_); }
+
   private:
-    G1PConnector<SubjectType, CallbackType> *connector_{nullptr};
-    GConnectable *instance_{nullptr};
+    Signal *signal_{nullptr};
+    GConnectionHandle handle_;
 };
 
-} // namespace gbase
\ No newline at end of file
+/**
+ * @brief Connects an instance to a G0PConnector and disconnects it when destroyed.
+ */
+template <typename SubjectType> using G0PAutoConnection = GAutoConnection<SubjectType>;
+
+/**
+ * @brief Connects an instance to a G1PConnector and disconnects it when destroyed.
+ */
+template <typename SubjectType, typename CallbackType>
+using G1PAutoConnection = GAutoConnection<SubjectType, CallbackType>;
+
+} // namespace gbase
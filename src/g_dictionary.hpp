@@ -2,8 +2,11 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <ostream>
+#include <utility>
 
 #include "g_basic_types.hpp"
 #include "g_vector.hpp"
@@ -12,16 +15,32 @@ namespace gbase {
 
 /**
  * @brief A specialization of the std::map.
+ *
+ * The allocator is passed on to std::map, which allocates one node per key. A copy of a pmr::GDictionary uses
+ * the default memory resource, unless the allocator is given to the copy constructor.
  */
-template <typename Key, typename Value> class GDictionary : private std::map<Key, Value> {
-    using base = std::map<Key, Value>;
+template <typename Key, typename Value, typename Allocator = std::allocator<std::pair<const Key, Value>>>
+class GDictionary : private std::map<Key, Value, std::less<Key>, Allocator> {
+    using base = std::map<Key, Value, std::less<Key>, Allocator>;
 
   public:
     GDictionary() = default;
 
-    GDictionary(std::initializer_list<std::pair<const Key, Value>> initList) : base(initList) {}
+    explicit GDictionary(const Allocator &allocator) : base(allocator) {}
 
-    GDictionary(const std::map<Key, Value> &m) : base{m} {}
+    GDictionary(std::initializer_list<std::pair<const Key, Value>> initList,
+                const Allocator &allocator = Allocator())
+        : base(initList, allocator) {}
+
+    GDictionary(const std::map<Key, Value, std::less<Key>, Allocator> &m) : base{m} {}
+
+    GDictionary(const GDictionary &other) = default;
+    GDictionary(GDictionary &&other) noexcept = default;
+    GDictionary(const GDictionary &other, const Allocator &allocator) : base(other, allocator) {}
+    GDictionary(GDictionary &&other, const Allocator &allocator) : base(std::move(other), allocator) {}
+
+    GDictionary &operator=(const GDictionary &other) = default;
+    GDictionary &operator=(GDictionary &&other) = default;
 
     ~GDictionary() = default;
 
@@ -60,6 +79,7 @@ template <typename Key, typename Value> class GDictionary : private std::map<Key
     using base::erase;
     using base::extract;
     using base::find;
+    using base::get_allocator;
     using base::insert;
     using base::merge;
     using base::rbegin;
@@ -128,10 +148,21 @@ template <typename Key, typename Value> class GDictionary : private std::map<Key
     }
 };
 
-template <typename Key, typename Value>
-std::ostream &operator<<(std::ostream &os, const GDictionary<Key, Value> &dict) {
+template <typename Key, typename Value, typename Allocator>
+std::ostream &operator<<(std::ostream &os, const GDictionary<Key, Value, Allocator> &dict) {
     dict.print(os);
     return os;
 }
 
+namespace pmr {
+
+/**
+ * @brief A GDictionary which allocates its nodes from a std::pmr::memory_resource, e.g. an arena.
+ */
+template <typename Key, typename Value>
+using GDictionary =
+    gbase::GDictionary<Key, Value, std::pmr::polymorphic_allocator<std::pair<const Key, Value>>>;
+
+} // namespace pmr
+
 } // namespace gbase
\ No newline at end of file
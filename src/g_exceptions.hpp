@@ -13,6 +13,7 @@ namespace gbase {
 using GException = std::exception;
 using GOutOfRange = std::out_of_range;
 using GInvalidArgument = std::invalid_argument;
+using GRuntimeError = std::runtime_error;
 
 /**
  * @def GTHROW(exc, ...)
@@ -0,0 +1,470 @@
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <ostream>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "g_basic_types.hpp"
+#include "g_set_algebra.hpp"
+#include "g_sort.hpp"
+
+namespace gbase {
+
+/**
+ * @brief A set which stores its values sorted in one contiguous array, with the same API as GSet.
+ *
+ * Lookups are binary searches and iteration walks the array, so a set which is built once and read often
+ * uses less memory and is faster than a GSet. Inserting or removing a single value moves the values after
+ * it, so values should be added in batches with extend(), which sorts the new values and merges them in.
+ *
+ * The iterators are const, since changing a value could break the order, and are invalidated by any
+ * insertion or removal. The allocator is passed on to the std::vector which stores the values.
+ *
+ * Example usage:
+ * @code
+ * GFlatSet<Integer> ids;
+ * ids += GVector<Integer>{7, 3, 5, 3};    // [3, 5, 7]
+ * ids.distance(5);                         // 1
+ * @endcode
+ */
+template <typename Type, typename Allocator = std::allocator<Type>> class GFlatSet {
+  private:
+    using Storage = std::vector<Type, Allocator>;
+
+  public:
+    using allocator_type = Allocator;
+    using const_iterator = typename Storage::const_iterator;
+    using const_pointer = typename Storage::const_pointer;
+    using const_reference = typename Storage::const_reference;
+    using const_reverse_iterator = typename Storage::const_reverse_iterator;
+    using difference_type = typename Storage::difference_type;
+    using iterator = const_iterator;
+    using key_compare = std::less<Type>;
+    using key_type = Type;
+    using pointer = const_pointer;
+    using reference = const_reference;
+    using reverse_iterator = const_reverse_iterator;
+    using size_type = typename Storage::size_type;
+    using value_compare = std::less<Type>;
+    using value_type = Type;
+
+    GFlatSet() = default;
+
+    explicit GFlatSet(const Allocator &allocator) : values_(allocator) {}
+
+    GFlatSet(std::initializer_list<Type> initList, const Allocator &allocator = Allocator())
+        : values_(initList, allocator) {
+        sortAndRemoveDuplicates(0);
+    }
+
+    template <InputIteratorOf<Type> InputIt>
+    GFlatSet(InputIt first, InputIt last, const Allocator &allocator = Allocator())
+        : values_(first, last, allocator) {
+        sortAndRemoveDuplicates(0);
+    }
+
+    template <RangeOf<Type> Range>
+    explicit GFlatSet(const Range &range, const Allocator &allocator = Allocator())
+        : values_(std::ranges::begin(range), std::ranges::end(range), allocator) {
+        sortAndRemoveDuplicates(0);
+    }
+
+    GFlatSet(const GFlatSet &other) = default;
+    GFlatSet(GFlatSet &&other) noexcept = default;
+    GFlatSet(const GFlatSet &other, const Allocator &allocator) : values_(other.values_, allocator) {}
+    GFlatSet(GFlatSet &&other, const Allocator &allocator) : values_(std::move(other.values_), allocator) {}
+
+    GFlatSet &operator=(const GFlatSet &other) = default;
+    GFlatSet &operator=(GFlatSet &&other) = default;
+
+    ~GFlatSet() = default;
+
+    template <RangeOf<Type> Range> const GFlatSet &operator=(const Range &range) {
+        values_.assign(std::ranges::begin(range), std::ranges::end(range));
+        sortAndRemoveDuplicates(0);
+        return *this;
+    }
+
+    auto operator<=>(const GFlatSet &other) const { return values_ <=> other.values_; }
+    bool operator==(const GFlatSet &other) const { return values_ == other.values_; }
+    bool operator!=(const GFlatSet &other) const { return values_ != other.values_; }
+
+    const_iterator begin() const { return values_.begin(); }
+    const_iterator end() const { return values_.end(); }
+    const_iterator cbegin() const { return values_.cbegin(); }
+    const_iterator cend() const { return values_.cend(); }
+    const_reverse_iterator rbegin() const { return values_.rbegin(); }
+    const_reverse_iterator rend() const { return values_.rend(); }
+    const_reverse_iterator crbegin() const { return values_.crbegin(); }
+    const_reverse_iterator crend() const { return values_.crend(); }
+
+    bool empty() const { return values_.empty(); }
+    Size size() const { return values_.size(); }
+    Size max_size() const { return values_.max_size(); }
+    Size maxSize() const { return values_.max_size(); }
+    Size capacity() const { return values_.capacity(); }
+    void reserve(Size capacity) { values_.reserve(capacity); }
+    void clear() { values_.clear(); }
+    void swap(GFlatSet &other) noexcept { values_.swap(other.values_); }
+    Allocator get_allocator() const { return values_.get_allocator(); }
+
+    /**
+     * @brief Gives the values in ascending order as one contiguous view.
+     */
+    std::span<const Type> span() const { return {values_.data(), values_.size()}; }
+
+    const_iterator lower_bound(const Type &value) const { return std::ranges::lower_bound(values_, value); }
+    const_iterator upper_bound(const Type &value) const { return std::ranges::upper_bound(values_, value); }
+
+    const_iterator find(const Type &value) const {
+        const auto it = lower_bound(value);
+        return it != end() && !(value < *it) ? it : end();
+    }
+
+    bool contains(const Type &value) const { return find(value) != end(); }
+    Size count(const Type &value) const { return contains(value) ? 1 : 0; }
+
+    /**
+     * @brief Inserts a value, moving the greater values one step.
+     * @return The position of the value, and true if it was inserted or false if it was already in the set.
+     */
+    std::pair<const_iterator, bool> insert(const Type &value) {
+        const auto it = lower_bound(value);
+        if (it != end() && !(value < *it)) {
+            return {it, false};
+        }
+        return {values_.insert(it, value), true};
+    }
+
+    template <typename... Args> std::pair<const_iterator, bool> emplace(Args &&...args) {
+        return insert(Type(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Removes a value, moving the greater values one step.
+     * @return The number of values removed, i.e. 0 or 1.
+     */
+    Size erase(const Type &value) {
+        const auto it = find(value);
+        if (it == end()) {
+            return 0;
+        }
+        values_.erase(it);
+        return 1;
+    }
+
+    const_iterator erase(const_iterator position) { return values_.erase(position); }
+    const_iterator erase(const_iterator first, const_iterator last) { return values_.erase(first, last); }
+
+    /**
+     * @brief Inserts a value into the set.
+     */
+    void extend(const Type &newValue) { insert(newValue); }
+
+    /**
+     * @brief Inserts a range of values into the set. The values are appended, sorted and merged with the
+     * values of the set, which costs O(n + m log m) instead of one O(n) insertion per value.
+     */
+    template <RangeOf<Type> Range> void extend(const Range &values) {
+        const Size oldSize = size();
+        values_.insert(values_.end(), std::ranges::begin(values), std::ranges::end(values));
+        sortAndRemoveDuplicates(oldSize);
+    }
+
+    /**
+     * @brief Inserts an initializer list of values into the set, see extend(const Range &).
+     */
+    void extend(std::initializer_list<Type> initList) {
+        const Size oldSize = size();
+        values_.insert(values_.end(), initList.begin(), initList.end());
+        sortAndRemoveDuplicates(oldSize);
+    }
+
+    /**
+     * @brief Inserts a value into the set.
+     */
+    void operator+=(const Type &newValue) { extend(newValue); }
+
+    /**
+     * @brief Inserts a range of values into the set.
+     */
+    template <RangeOf<Type> Range> void operator+=(const Range &values) { extend(values); }
+
+    /**
+     * @brief Inserts an initializer list of values into the set.
+     */
+    void operator+=(std::initializer_list<Type> initList) { extend(initList); }
+
+    /**
+     * @brief Removes a range of values from the set in one pass over the set.
+     */
+    template <RangeOf<Type> Range> void erase(const Range &values) {
+        GFlatSet removed(values, get_allocator());
+        std::erase_if(values_, [&removed](const Type &value) { return removed.contains(value); });
+    }
+
+    /**
+     * @brief Removes the values of the given set in one pass over both sets, which moves the remaining values
+     * in place. The values before the first value of the given set are skipped with a binary search.
+     */
+    void erase(const GFlatSet &values) {
+        if (&values == this) {
+            clear();
+            return;
+        }
+        if (values.empty()) {
+            return;
+        }
+
+        auto read = std::ranges::lower_bound(values_, values.values_.front());
+        auto write = read;
+        for (auto other = values.values_.begin(); read != values_.end() && other != values.values_.end();) {
+            if (*read < *other) {
+                if (write != read) {
+                    *write = std::move(*read);
+                }
+                ++write;
+                ++read;
+            } else if (*other < *read) {
+                ++other;
+            } else {
+                ++read;
+                ++other;
+            }
+        }
+        if (write != read) {
+            values_.erase(std::move(read, values_.end(), write), values_.end());
+        }
+    }
+
+    /**
+     * @brief Removes a value from the set.
+     */
+    void operator-=(const Type &newValue) { erase(newValue); }
+
+    /**
+     * @brief Removes a range of values from the set.
+     */
+    template <RangeOf<Type> Range> void operator-=(const Range &values) { erase(values); }
+
+    /**
+     * @brief Tests if this set is a superset of given set.
+     */
+    bool isSupersetOf(const GFlatSet &set) const { return std::ranges::includes(values_, set.values_); }
+
+    /**
+     * @brief Tests if this set is a subset of given set.
+     */
+    bool isSubsetOf(const GFlatSet &set) const { return std::ranges::includes(set.values_, values_); }
+
+    /**
+     * @brief Returns the values which are in both sets. 32 bit integers are intersected with SSE2, see
+     * intersectSorted(), which also writes the values into a buffer given by the caller.
+     */
+    GFlatSet intersect(const GFlatSet &set) const {
+        return combine(std::min(size(), set.size()),
+                       [&](std::span<Type> output) { return intersectSorted(values_, set.values_, output); });
+    }
+
+    /**
+     * @brief Returns the values which are in either set.
+     */
+    GFlatSet unite(const GFlatSet &set) const {
+        return combine(size() + set.size(),
+                       [&](std::span<Type> output) { return uniteSorted(values_, set.values_, output); });
+    }
+
+    /**
+     * @brief Returns the values of this set which are not in the given set.
+     */
+    GFlatSet difference(const GFlatSet &set) const {
+        return combine(size(), [&](std::span<Type> output) {
+            return differenceSorted(values_, set.values_, output);
+        });
+    }
+
+    /**
+     * @brief Returns the values which are in exactly one of the sets.
+     */
+    GFlatSet symmetricDifference(const GFlatSet &set) const {
+        return combine(size() + set.size(), [&](std::span<Type> output) {
+            return symmetricDifferenceSorted(values_, set.values_, output);
+        });
+    }
+
+    /**
+     * @brief Searches for a value in the set with a binary search.
+     * @return The index of the value in the ascending order, or -1 if the value was not found.
+     */
+    Integer distance(const Type &value) const {
+        const auto it = find(value);
+        return it != end() ? static_cast<Integer>(it - begin()) : -1;
+    }
+
+    /**
+     * @brief Prints a text representaion of the set.
+     */
+    void print(std::ostream &target) const {
+        target << '[';
+
+        if (!empty()) {
+            auto it = begin();
+            target << *it++;
+
+            while (it != end()) {
+                target << ", " << *it++;
+            }
+        }
+
+        target << ']';
+    }
+
+  private:
+    /**
+     * @brief Returns a set with the values which the kernel writes to an output of the given capacity.
+     */
+    template <typename Kernel> GFlatSet combine(Size capacity, Kernel kernel) const {
+        GFlatSet result(get_allocator());
+        result.values_.resize(capacity);
+        result.values_.resize(kernel(std::span<Type>{result.values_}));
+        return result;
+    }
+
+    /**
+     * @brief Sorts the values from the given index, removes the duplicates and merges them with the sorted
+     * values before the index.
+     */
+    void sortAndRemoveDuplicates(Size sortedCount) {
+        const auto middle = values_.begin() + static_cast<difference_type>(sortedCount);
+        if constexpr (RadixSortable<Type>) {
+            radixSort(std::span<Type>{middle, values_.end()});
+        } else {
+            std::sort(middle, values_.end());
+        }
+        std::inplace_merge(values_.begin(), middle, values_.end());
+        values_.erase(std::unique(values_.begin(), values_.end()), values_.end());
+    }
+
+    Storage values_;
+};
+
+/**
+ * @brief Returns a copy of set with given value inserted.
+ */
+template <typename Type, typename Allocator>
+GFlatSet<Type, Allocator> operator+(const GFlatSet<Type, Allocator> &set, const Type &value) {
+    GFlatSet<Type, Allocator> copy(set, set.get_allocator());
+    copy += value;
+    return copy;
+}
+
+/**
+ * @brief Inserts given value into the temporary set and returns it without copying.
+ */
+template <typename Type, typename Allocator>
+GFlatSet<Type, Allocator> operator+(GFlatSet<Type, Allocator> &&set, const Type &value) {
+    set += value;
+    return std::move(set);
+}
+
+/**
+ * @brief Returns a copy of set with given value removed.
+ */
+template <typename Type, typename Allocator>
+GFlatSet<Type, Allocator> operator-(const GFlatSet<Type, Allocator> &set, const Type &value) {
+    GFlatSet<Type, Allocator> copy(set, set.get_allocator());
+    copy -= value;
+    return copy;
+}
+
+/**
+ * @brief Removes given value from the temporary set and returns it without copying.
+ */
+template <typename Type, typename Allocator>
+GFlatSet<Type, Allocator> operator-(GFlatSet<Type, Allocator> &&set, const Type &value) {
+    set -= value;
+    return std::move(set);
+}
+
+/**
+ * @brief Returns a copy of set with given range of values inserted.
+ */
+template <typename Type, typename Allocator, RangeOf<Type> Range>
+GFlatSet<Type, Allocator> operator+(const GFlatSet<Type, Allocator> &set, const Range &range) {
+    GFlatSet<Type, Allocator> copy(set, set.get_allocator());
+    copy.extend(range);
+    return copy;
+}
+
+/**
+ * @brief Inserts given range of values into the temporary set and returns it without copying.
+ */
+template <typename Type, typename Allocator, RangeOf<Type> Range>
+GFlatSet<Type, Allocator> operator+(GFlatSet<Type, Allocator> &&set, const Range &range) {
+    set.extend(range);
+    return std::move(set);
+}
+
+/**
+ * @brief Returns a copy of set with given range of values removed.
+ */
+template <typename Type, typename Allocator, RangeOf<Type> Range>
+GFlatSet<Type, Allocator> operator-(const GFlatSet<Type, Allocator> &set, const Range &range) {
+    GFlatSet<Type, Allocator> copy(set, set.get_allocator());
+    copy.erase(range);
+    return copy;
+}
+
+/**
+ * @brief Removes given range of values from the temporary set and returns it without copying.
+ */
+template <typename Type, typename Allocator, RangeOf<Type> Range>
+GFlatSet<Type, Allocator> operator-(GFlatSet<Type, Allocator> &&set, const Range &range) {
+    set.erase(range);
+    return std::move(set);
+}
+
+/**
+ * @brief Returns the values of the first set which are not in the second set, in one pass over both sets.
+ */
+template <typename Type, typename Allocator>
+GFlatSet<Type, Allocator> operator-(const GFlatSet<Type, Allocator> &first,
+                                    const GFlatSet<Type, Allocator> &second) {
+    return first.difference(second);
+}
+
+/**
+ * @brief Removes the values of the second set from the temporary first set and returns it without copying,
+ * see erase().
+ */
+template <typename Type, typename Allocator>
+GFlatSet<Type, Allocator> operator-(GFlatSet<Type, Allocator> &&first,
+                                    const GFlatSet<Type, Allocator> &second) {
+    first.erase(second);
+    return std::move(first);
+}
+
+template <typename Type, typename Allocator>
+std::ostream &operator<<(std::ostream &s, const GFlatSet<Type, Allocator> &v) {
+    v.print(s);
+    return s;
+}
+
+namespace pmr {
+
+/**
+ * @brief A GFlatSet which allocates its array from a std::pmr::memory_resource, e.g. an arena.
+ */
+template <typename Type> using GFlatSet = gbase::GFlatSet<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
+} // namespace gbase
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "g_basic_types.hpp"
+
+namespace gbase {
+
+/**
+ * @brief The default number of bytes a GInplaceFunction stores inline, enough for a pointer to an object
+ * and a pointer to one of its member functions.
+ */
+constexpr Size InplaceFunctionCapacity = 3 * sizeof(void *);
+
+template <typename Signature, Size Capacity = InplaceFunctionCapacity> class GInplaceFunction;
+
+/**
+ * @brief A copyable callable wrapper like std::function, which stores callables of up to Capacity bytes
+ * inside the object instead of on the heap. Larger callables are moved to the heap.
+ *
+ * The call goes through a single function pointer stored next to the callable, so a contiguous array of
+ * GInplaceFunction can be called without touching any other memory.
+ *
+ * Example usage:
+ * @code
+ * GInplaceFunction<Integer(Integer)> twice = [](Integer value) { return 2 * value; };
+ * twice(4); // 8
+ * @endcode
+ */
+template <typename Result, typename... Args, Size Capacity>
+class GInplaceFunction<Result(Args...), Capacity> {
+    static_assert(Capacity >= sizeof(void *), "The inline storage must at least hold a pointer.");
+
+  public:
+    GInplaceFunction() = default;
+    GInplaceFunction(std::nullptr_t) {}
+
+    template <typename Callable>
+        requires(!std::is_same_v<std::remove_cvref_t<Callable>, GInplaceFunction> &&
+                 std::is_invocable_r_v<Result, std::decay_t<Callable> &, Args...>)
+    GInplaceFunction(Callable &&callable) {
+        using Stored = std::decay_t<Callable>;
+        if constexpr (std::is_pointer_v<Stored> || std::is_member_pointer_v<Stored> ||
+                      std::is_same_v<Stored, std::function<Result(Args...)>>) {
+            if (!callable) {
+                return;
+            }
+        }
+
+        if constexpr (FitsInline<Stored>) {
+            ::new (static_cast<void *>(storage_)) Stored(std::forward<Callable>(callable));
+            invoke_ = &invokeInline<Stored>;
+            manager_ = &manageInline<Stored>;
+        } else {
+            ::new (static_cast<void *>(storage_)) Stored *(new Stored(std::forward<Callable>(callable)));
+            invoke_ = &invokeHeap<Stored>;
+            manager_ = &manageHeap<Stored>;
+        }
+    }
+
+    GInplaceFunction(const GInplaceFunction &other) : invoke_{other.invoke_}, manager_{other.manager_} {
+        if (manager_ != nullptr) {
+            manager_(Operation::Copy, storage_, const_cast<std::byte *>(other.storage_));
+        }
+    }
+
+    GInplaceFunction(GInplaceFunction &&other) noexcept : invoke_{other.invoke_}, manager_{other.manager_} {
+        if (manager_ != nullptr) {
+            manager_(Operation::Move, storage_, other.storage_);
+            other.reset();
+        }
+    }
+
+    GInplaceFunction &operator=(const GInplaceFunction &other) {
+        if (this != &other) {
+            GInplaceFunction copy{other};
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    GInplaceFunction &operator=(GInplaceFunction &&other) noexcept {
+        if (this != &other) {
+            reset();
+            invoke_ = other.invoke_;
+            manager_ = other.manager_;
+            if (manager_ != nullptr) {
+                manager_(Operation::Move, storage_, other.storage_);
+                other.reset();
+            }
+        }
+        return *this;
+    }
+
+    GInplaceFunction &operator=(std::nullptr_t) {
+        reset();
+        return *this;
+    }
+
+    ~GInplaceFunction() { reset(); }
+
+    explicit operator bool() const { return invoke_ != nullptr; }
+
+    /**
+     * @brief Calls the stored callable. Must not be called on an empty function.
+     */
+    Result operator()(Args... args) const {
+        return invoke_(const_cast<std::byte *>(storage_), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Tells if a callable of the given type is stored without allocating.
+     */
+    template <typename Callable>
+    static constexpr bool FitsInline = sizeof(Callable) <= Capacity && alignof(Callable) <= alignof(void *) &&
+                                       std::is_nothrow_move_constructible_v<Callable>;
+
+    /**
+     * @brief Tells if the stored callable lives on the heap.
+     */
+    bool isOnHeap() const { return manager_ != nullptr && manager_(Operation::IsOnHeap, nullptr, nullptr); }
+
+  private:
+    enum class Operation { Copy, Move, Destroy, IsOnHeap };
+
+    using Invoker = Result (*)(std::byte *, Args &&...);
+    using Manager = bool (*)(Operation, std::byte *, std::byte *);
+
+    void reset() {
+        if (manager_ != nullptr) {
+            manager_(Operation::Destroy, storage_, nullptr);
+        }
+        invoke_ = nullptr;
+        manager_ = nullptr;
+    }
+
+    template <typename Stored> static Stored &stored(std::byte *storage) {
+        return *std::launder(reinterpret_cast<Stored *>(storage));
+    }
+
+    template <typename Stored> static Result invokeInline(std::byte *storage, Args &&...args) {
+        return std::invoke(stored<Stored>(storage), std::forward<Args>(args)...);
+    }
+
+    template <typename Stored> static Result invokeHeap(std::byte *storage, Args &&...args) {
+        return std::invoke(*stored<Stored *>(storage), std::forward<Args>(args)...);
+    }
+
+    template <typename Stored>
+    static bool manageInline(Operation operation, std::byte *target, std::byte *source) {
+        switch (operation) {
+        case Operation::Copy:
+            ::new (static_cast<void *>(target)) Stored(std::as_const(stored<Stored>(source)));
+            break;
+        case Operation::Move:
+            ::new (static_cast<void *>(target)) Stored(std::move(stored<Stored>(source)));
+            break;
+        case Operation::Destroy:
+            stored<Stored>(target).~Stored();
+            break;
+        case Operation::IsOnHeap:
+            break;
+        }
+        return false;
+    }
+
+    template <typename Stored>
+    static bool manageHeap(Operation operation, std::byte *target, std::byte *source) {
+        switch (operation) {
+        case Operation::Copy:
+            ::new (static_cast<void *>(target)) Stored *(new Stored(*stored<Stored *>(source)));
+            break;
+        case Operation::Move:
+            ::new (static_cast<void *>(target)) Stored *(std::exchange(stored<Stored *>(source), nullptr));
+            break;
+        case Operation::Destroy:
+            delete stored<Stored *>(target);
+            break;
+        case Operation::IsOnHeap:
+            break;
+        }
+        return true;
+    }
+
+    alignas(void *) std::byte storage_[Capacity];
+    Invoker invoke_{nullptr};
+    Manager manager_{nullptr};
+};
+
+} // namespace gbase
@@ -0,0 +1,411 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "g_basic_types.hpp"
+#include "g_dictionary.hpp"
+#include "g_exceptions.hpp"
+#include "g_files.hpp"
+#include "g_log_record.hpp"
+#include "g_time.hpp"
+
+namespace gbase {
+
+/**
+ * @brief Identifies a binary log file. The number is the format version.
+ */
+constexpr std::array<Char, 8> BinaryLogMagic{'G', 'L', 'O', 'G', 'B', 'I', 'N', '1'};
+
+/**
+ * @brief The kinds of entries in a binary log file.
+ */
+enum class GBinaryLogTag : Byte {
+    CallSite = 1, ///< Defines a call site id: severity, level, line, file, function and format string.
+    Record = 2    ///< A log: call site id, timestamp and the arguments.
+};
+
+/**
+ * @brief The types of log arguments in a binary log file.
+ */
+enum class GLogArgumentTag : Byte { Bool, Char, Int, Unsigned, Double, String };
+
+/**
+ * @brief A decoded log argument.
+ */
+using GLogArgument = std::variant<bool, Char, std::int64_t, std::uint64_t, double, String>;
+
+/**
+ * @brief Writes logs as compact binary records instead of rendered text.
+ *
+ * Each record holds the id of its call site, a timestamp and the raw bytes of the arguments. File name,
+ * function name and format string are written once per call site. Arithmetic and string arguments are
+ * stored as they are, other arguments are rendered to text with operator<< or std::format. The numbers are
+ * stored in the byte order of the writing machine. Use GBinaryLogReader or the glog_decode tool to turn the
+ * file back into text.
+ */
+class GBinaryLogWriter {
+  public:
+    explicit GBinaryLogWriter(const GPath &path) : file_{path, std::ios::binary | std::ios::trunc} {
+        if (!file_) {
+            GTHROW(GInvalidArgument, "Could not open binary log file: ", path);
+        }
+        file_.write(BinaryLogMagic.data(), BinaryLogMagic.size());
+    }
+
+    GBinaryLogWriter(const GBinaryLogWriter &) = delete;
+    GBinaryLogWriter &operator=(const GBinaryLogWriter &) = delete;
+
+    ~GBinaryLogWriter() { flush(); }
+
+    /**
+     * @brief Writes a log record.
+     *
+     * @param format The std::format string of the call site, or an empty string when the arguments are
+     * concatenated.
+     */
+    template <typename... Args>
+    void write(const GLogCallSite &site, std::string_view format, const Args &...args) {
+        static_assert(sizeof...(Args) < 256, "A binary log record holds at most 255 arguments.");
+
+        static thread_local GLogBuffer<LogMessageCapacity> record;
+        record.clear();
+        appendValue(record, GBinaryLogTag::Record);
+        appendValue(record, static_cast<std::uint32_t>(site.id()));
+        appendValue(record, static_cast<std::int64_t>(GUTCTime::now().timeSinceEpoch().count()));
+        appendValue(record, static_cast<Byte>(sizeof...(Args)));
+        (appendArgument(record, args, format.empty()), ...);
+
+        std::lock_guard lock{mutex_};
+        defineCallSite(site, format);
+        file_.write(record.view().data(), static_cast<std::streamsize>(record.view().size()));
+    }
+
+    void flush() {
+        std::lock_guard lock{mutex_};
+        file_.flush();
+    }
+
+  private:
+    template <Size InlineCapacity, typename Type>
+    static void appendValue(GLogBuffer<InlineCapacity> &record, const Type &value) {
+        static_assert(std::is_trivially_copyable_v<Type>);
+        std::array<Char, sizeof(Type)> bytes;
+        std::memcpy(bytes.data(), &value, sizeof(Type));
+        record.append(std::string_view{bytes.data(), bytes.size()});
+    }
+
+    template <Size InlineCapacity>
+    static void appendString(GLogBuffer<InlineCapacity> &record, std::string_view text) {
+        appendValue(record, static_cast<std::uint32_t>(text.size()));
+        record.append(text);
+    }
+
+    /**
+     * @param streamed Renders non-arithmetic types with operator<< when true, otherwise with std::format.
+     */
+    template <Size InlineCapacity, typename Type>
+    static void appendArgument(GLogBuffer<InlineCapacity> &record, const Type &value, bool streamed) {
+        if constexpr (std::is_same_v<Type, bool>) {
+            appendValue(record, GLogArgumentTag::Bool);
+            appendValue(record, static_cast<Byte>(value));
+        } else if constexpr (std::is_same_v<Type, Char>) {
+            // signed char and unsigned char are numbers, as std::format prints them.
+            appendValue(record, GLogArgumentTag::Char);
+            appendValue(record, static_cast<Char>(value));
+        } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+            appendValue(record, GLogArgumentTag::Int);
+            appendValue(record, static_cast<std::int64_t>(value));
+        } else if constexpr (std::is_integral_v<Type>) {
+            appendValue(record, GLogArgumentTag::Unsigned);
+            appendValue(record, static_cast<std::uint64_t>(value));
+        } else if constexpr (std::is_floating_point_v<Type>) {
+            appendValue(record, GLogArgumentTag::Double);
+            appendValue(record, static_cast<double>(value));
+        } else if constexpr (std::is_convertible_v<const Type &, std::string_view>) {
+            appendValue(record, GLogArgumentTag::String);
+            appendString(record, std::string_view{value});
+        } else {
+            constexpr bool streamable = requires(std::ostream &os) { os << value; };
+            constexpr bool formattable = std::formattable<Type, Char>;
+            static_assert(streamable || formattable, "Log arguments need operator<< or a std::formatter.");
+
+            static thread_local GLogBuffer<LogMessageCapacity> text;
+            text.clear();
+            if constexpr (streamable) {
+                bool useStream{true};
+                if constexpr (formattable) {
+                    useStream = streamed;
+                }
+                if (useStream) {
+                    static thread_local GLogStream<LogMessageCapacity> stream;
+                    stream.reset();
+                    stream << value;
+                    text.append(stream.view());
+                } else {
+                    formatTo(text, value);
+                }
+            } else {
+                formatTo(text, value);
+            }
+            appendValue(record, GLogArgumentTag::String);
+            appendString(record, text.view());
+        }
+    }
+
+    template <Size InlineCapacity, typename Type>
+    static void formatTo(GLogBuffer<InlineCapacity> &text, const Type &value) {
+        if constexpr (std::formattable<Type, Char>) {
+            std::format_to(text.inserter(), "{}", value);
+        }
+    }
+
+    /**
+     * @brief Writes the definition of the call site the first time it is used in this file. The caller
+     * must hold mutex_.
+     */
+    void defineCallSite(const GLogCallSite &site, std::string_view format) {
+        const Size id = site.id();
+        if (id < defined_.size() && defined_[id]) {
+            return;
+        }
+        if (id >= defined_.size()) {
+            defined_.resize(id + 1, false);
+        }
+        defined_[id] = true;
+
+        GLogBuffer<LogRecordCapacity> definition;
+        appendValue(definition, GBinaryLogTag::CallSite);
+        appendValue(definition, static_cast<std::uint32_t>(id));
+        appendValue(definition, static_cast<Byte>(site.severity));
+        appendValue(definition, static_cast<Byte>(site.level));
+        appendValue(definition, static_cast<std::int32_t>(site.line));
+        appendString(definition, site.file);
+        appendString(definition, site.function);
+        appendString(definition, format);
+        file_.write(definition.view().data(), static_cast<std::streamsize>(definition.view().size()));
+    }
+
+    std::ofstream file_;
+    std::mutex mutex_;
+    std::vector<bool> defined_;
+};
+
+/**
+ * @brief A log read back from a binary log file.
+ */
+struct GBinaryLogEntry {
+    GLogSeverity severity{GLogSeverity::Info};
+    GLogLevel level{GLogLevel::Normal};
+    std::chrono::nanoseconds timeSinceEpoch{0};
+    String file;
+    String function;
+    Integer line{0};
+    String text; ///< The rendered text of the log, without file name and function name.
+
+    /**
+     * @brief Gives the message in the layout of the text logs: "file | function | text".
+     */
+    String message() const { return file + " | " + function + " | " + text; }
+};
+
+/**
+ * @brief Reads a file written by GBinaryLogWriter.
+ *
+ * Example usage:
+ * @code
+ * GBinaryLogReader reader{"app.glog"};
+ * while (const auto entry = reader.next()) {
+ *     std::cout << entry->message() << std::endl;
+ * }
+ * @endcode
+ */
+class GBinaryLogReader {
+  public:
+    explicit GBinaryLogReader(const GPath &path) : file_{path, std::ios::binary} {
+        if (!file_) {
+            GTHROW(GInvalidArgument, "Could not open binary log file: ", path);
+        }
+        std::array<Char, BinaryLogMagic.size()> magic{};
+        file_.read(magic.data(), magic.size());
+        if (!file_ || magic != BinaryLogMagic) {
+            GTHROW(GInvalidArgument, "Not a binary log file: ", path);
+        }
+    }
+
+    ~GBinaryLogReader() = default;
+
+    /**
+     * @brief Reads the next log.
+     * @return The log, or std::nullopt at the end of the file.
+     */
+    std::optional<GBinaryLogEntry> next() {
+        for (;;) {
+            GBinaryLogTag tag{};
+            if (!file_.read(reinterpret_cast<Char *>(&tag), sizeof(tag))) {
+                return std::nullopt;
+            }
+
+            if (tag == GBinaryLogTag::CallSite) {
+                readCallSite();
+            } else if (tag == GBinaryLogTag::Record) {
+                return readRecord();
+            } else {
+                GTHROW(GInvalidArgument, "Corrupt binary log file, unknown tag: ", static_cast<Integer>(tag));
+            }
+        }
+    }
+
+  private:
+    struct CallSite {
+        GLogSeverity severity{GLogSeverity::Info};
+        GLogLevel level{GLogLevel::Normal};
+        Integer line{0};
+        String file;
+        String function;
+        String format;
+    };
+
+    template <typename Type> Type readValue() {
+        Type value{};
+        if (!file_.read(reinterpret_cast<Char *>(&value), sizeof(Type))) {
+            GTHROW(GInvalidArgument, "Corrupt binary log file, unexpected end of file.");
+        }
+        return value;
+    }
+
+    String readString() {
+        String text(readValue<std::uint32_t>(), '\0');
+        if (!file_.read(text.data(), static_cast<std::streamsize>(text.size()))) {
+            GTHROW(GInvalidArgument, "Corrupt binary log file, unexpected end of file.");
+        }
+        return text;
+    }
+
+    void readCallSite() {
+        const auto id = readValue<std::uint32_t>();
+        CallSite site;
+        site.severity = static_cast<GLogSeverity>(readValue<Byte>());
+        site.level = static_cast<GLogLevel>(readValue<Byte>());
+        site.line = readValue<std::int32_t>();
+        site.file = readString();
+        site.function = readString();
+        site.format = readString();
+        callSites_.erase(id);
+        callSites_.emplace(id, std::move(site));
+    }
+
+    GLogArgument readArgument() {
+        switch (readValue<GLogArgumentTag>()) {
+        case GLogArgumentTag::Bool:
+            return readValue<Byte>() != 0;
+        case GLogArgumentTag::Char:
+            return readValue<Char>();
+        case GLogArgumentTag::Int:
+            return readValue<std::int64_t>();
+        case GLogArgumentTag::Unsigned:
+            return readValue<std::uint64_t>();
+        case GLogArgumentTag::Double:
+            return readValue<double>();
+        case GLogArgumentTag::String:
+            return readString();
+        }
+        GTHROW(GInvalidArgument, "Corrupt binary log file, unknown argument type.");
+    }
+
+    GBinaryLogEntry readRecord() {
+        const auto id = readValue<std::uint32_t>();
+        const auto sinceEpoch = readValue<std::int64_t>();
+        const auto argumentCount = readValue<Byte>();
+
+        std::vector<GLogArgument> arguments;
+        arguments.reserve(argumentCount);
+        for (Byte i = 0; i < argumentCount; ++i) {
+            arguments.push_back(readArgument());
+        }
+
+        if (!callSites_.contains(id)) {
+            GTHROW(GInvalidArgument, "Corrupt binary log file, undefined call site: ", id);
+        }
+        const CallSite &site = callSites_[id];
+
+        GBinaryLogEntry entry;
+        entry.severity = site.severity;
+        entry.level = site.level;
+        entry.timeSinceEpoch = std::chrono::nanoseconds{sinceEpoch};
+        entry.file = site.file;
+        entry.function = site.function;
+        entry.line = site.line;
+        entry.text = site.format.empty() ? concatenate(arguments) : format(site.format, arguments);
+        return entry;
+    }
+
+    /**
+     * @brief Renders the arguments the way operator<< renders them in the GLOG_* macros.
+     */
+    static String concatenate(const std::vector<GLogArgument> &arguments) {
+        std::ostringstream oss;
+        for (const auto &argument : arguments) {
+            std::visit([&oss](const auto &value) { oss << value; }, argument);
+        }
+        return oss.str();
+    }
+
+    /**
+     * @brief Renders the arguments into the std::format string of a GLOG_*_FMT macro.
+     */
+    static String format(std::string_view format, const std::vector<GLogArgument> &arguments) {
+        String result;
+        Size nextArgument{0};
+
+        for (Size i = 0; i < format.size(); ++i) {
+            const Char c = format[i];
+            if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c) {
+                result += c;
+                ++i;
+                continue;
+            }
+            if (c != '{') {
+                result += c;
+                continue;
+            }
+
+            const Size close = format.find('}', i);
+            if (close == std::string_view::npos) {
+                GTHROW(GInvalidArgument, "Invalid format string in binary log file: ", format);
+            }
+
+            const std::string_view field = format.substr(i + 1, close - i - 1);
+            const Size colon = field.find(':');
+            const std::string_view index = field.substr(0, colon);
+            const std::string_view spec = colon == std::string_view::npos ? "" : field.substr(colon);
+
+            const Size argumentIndex = index.empty() ? nextArgument++ : std::stoul(String{index});
+            if (argumentIndex >= arguments.size()) {
+                GTHROW(GInvalidArgument, "Missing argument in binary log file for: ", format);
+            }
+
+            const String fieldFormat = "{" + String{spec} + "}";
+            std::visit(
+                [&](const auto &value) { result += std::vformat(fieldFormat, std::make_format_args(value)); },
+                arguments[argumentIndex]);
+            i = close;
+        }
+        return result;
+    }
+
+    std::ifstream file_;
+    GDictionary<std::uint32_t, CallSite> callSites_;
+};
+
+} // namespace gbase
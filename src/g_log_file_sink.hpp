@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <mutex>
+#include <string_view>
+
+#include "g_basic_types.hpp"
+#include "g_exceptions.hpp"
+#include "g_files.hpp"
+#include "g_log_record.hpp"
+#include "g_log_sinks.hpp"
+#include "g_mapped_file.hpp"
+
+namespace gbase {
+
+/**
+ * @brief Settings of GMappedFileLogSink.
+ */
+struct GLogFileOptions {
+    GPath basePath{"log"};                         ///< The segments are named basePath.000001.log and so on.
+    Size segmentSize{16 * 1024 * 1024};            ///< The maximum size in bytes of one segment.
+    std::chrono::milliseconds rotationInterval{0}; ///< Starts a new segment this often, unless zero.
+    Size maxSegments{0};                           ///< Removes older segments beyond this count, unless zero.
+};
+
+/**
+ * @brief Writes logs as plain text to memory-mapped file segments.
+ *
+ * A log is written with a single memcpy into the mapped segment, so logging does not make any system calls
+ * except when a new segment is started. When a segment is full, or rotationInterval has elapsed, it is
+ * truncated to its used size and a new segment is started. Segments of an earlier run with the same base
+ * path are kept and the numbering continues after them.
+ *
+ * flush() only hands the pages completed since the previous flush to the operating system, so it is cheap to
+ * call after every log. The logs are readable by other processes as soon as they are written; use sync() to
+ * make sure they are on disk.
+ */
+class GMappedFileLogSink : public GLogSink {
+  public:
+    explicit GMappedFileLogSink(GLogFileOptions options) : options_{std::move(options)} {
+        if (options_.segmentSize == 0) {
+            GTHROW(GInvalidArgument, "Log segment size must be positive.");
+        }
+        segmentIndex_ = lastSegmentIndex();
+        startSegment();
+    }
+
+    ~GMappedFileLogSink() override { file_.close(used_); }
+
+    void write(const GLogEntry &entry) override {
+        static thread_local GLogBuffer<LogMessageCapacity + LogRecordCapacity> record;
+        record.clear();
+        appendLogRecord(record, entry.severity, entry.timestamp, entry.message, false);
+        record.append('\n');
+        const std::string_view text = record.view().substr(0, options_.segmentSize);
+
+        std::lock_guard lock{mutex_};
+        if (used_ + text.size() > file_.size() || rotationDue()) {
+            file_.close(used_);
+            startSegment();
+        }
+        std::memcpy(file_.data() + used_, text.data(), text.size());
+        used_ += text.size();
+    }
+
+    void flush() override {
+        std::lock_guard lock{mutex_};
+        const Size completed = used_ - used_ % GMappedFile::pageSize();
+        if (completed > synced_) {
+            file_.sync(synced_, completed - synced_);
+            synced_ = completed;
+        }
+    }
+
+    /**
+     * @brief Blocks until all logs written so far are on disk.
+     */
+    void sync() {
+        std::lock_guard lock{mutex_};
+        file_.sync(0, used_, true);
+        synced_ = used_ - used_ % GMappedFile::pageSize();
+    }
+
+    /**
+     * @brief Gives the path of the segment which logs are currently written to.
+     */
+    GPath currentSegment() const {
+        std::lock_guard lock{mutex_};
+        return segmentPath(segmentIndex_);
+    }
+
+    /**
+     * @brief Gives the path of the segment with given number.
+     */
+    GPath segmentPath(Size index) const {
+        GPath path = options_.basePath;
+        path += std::format(".{:06d}.log", index);
+        return path;
+    }
+
+  private:
+    bool rotationDue() const {
+        return options_.rotationInterval.count() != 0 &&
+               std::chrono::steady_clock::now() - segmentStart_ >= options_.rotationInterval;
+    }
+
+    void startSegment() {
+        ++segmentIndex_;
+        file_ = GMappedFile{segmentPath(segmentIndex_), options_.segmentSize};
+        used_ = 0;
+        synced_ = 0;
+        segmentStart_ = std::chrono::steady_clock::now();
+
+        if (options_.maxSegments != 0 && segmentIndex_ > options_.maxSegments) {
+            std::error_code error;
+            std::filesystem::remove(segmentPath(segmentIndex_ - options_.maxSegments), error);
+        }
+    }
+
+    /**
+     * @brief Finds the highest segment number of an earlier run, or zero.
+     */
+    Size lastSegmentIndex() const {
+        GPath directory = options_.basePath.parent_path();
+        if (directory.empty()) {
+            directory = ".";
+        }
+        const String prefix = options_.basePath.filename().string() + ".";
+        const std::string_view suffix{".log"};
+
+        Size last{0};
+        std::error_code error;
+        for (const auto &file : std::filesystem::directory_iterator(directory, error)) {
+            const String name = file.path().filename().string();
+            if (name.size() <= prefix.size() + suffix.size() || !name.starts_with(prefix) ||
+                !name.ends_with(suffix)) {
+                continue;
+            }
+            const std::string_view digits{name.data() + prefix.size(),
+                                          name.size() - prefix.size() - suffix.size()};
+            Size index{0};
+            const auto [end, result] = std::from_chars(digits.data(), digits.data() + digits.size(), index);
+            if (result == std::errc{} && end == digits.data() + digits.size()) {
+                last = std::max(last, index);
+            }
+        }
+        return last;
+    }
+
+    const GLogFileOptions options_;
+    mutable std::mutex mutex_;
+    GMappedFile file_;
+    Size segmentIndex_{0};
+    Size used_{0};
+    Size synced_{0};
+    std::chrono::steady_clock::time_point segmentStart_;
+};
+
+} // namespace gbase
@@ -0,0 +1,330 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <streambuf>
+#include <string_view>
+
+#include "g_basic_types.hpp"
+#include "g_print_tools.hpp"
+#include "g_time.hpp"
+
+namespace gbase {
+
+/**
+ * @brief The detail levels of logging. A log is captured if its level is less or equal to the current level.
+ */
+enum class GLogLevel { None, Normal, Details };
+
+/**
+ * @brief The kinds of log messages.
+ */
+enum class GLogSeverity { Info, Warning };
+
+/**
+ * @brief Character buffer which keeps up to InlineCapacity characters without allocating, and spills over to
+ * a heap allocated string beyond that. Once spilled, clear() keeps the heap capacity for reuse.
+ */
+template <Size InlineCapacity> class GLogBuffer {
+  public:
+    /**
+     * @brief Output iterator which appends to the buffer, e.g. as the target of std::format_to.
+     */
+    class Inserter {
+      public:
+        using iterator_category = std::output_iterator_tag;
+        using value_type = void;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = void;
+
+        Inserter() = default;
+        explicit Inserter(GLogBuffer &buffer) : buffer_{&buffer} {}
+
+        Inserter &operator=(Char c) {
+            buffer_->append(c);
+            return *this;
+        }
+
+        Inserter &operator*() { return *this; }
+        Inserter &operator++() { return *this; }
+        Inserter operator++(int) { return *this; }
+
+      private:
+        GLogBuffer *buffer_{nullptr};
+    };
+
+    GLogBuffer() = default;
+    explicit GLogBuffer(std::string_view text) { append(text); }
+
+    GLogBuffer(const GLogBuffer &other) { append(other.view()); }
+    GLogBuffer(GLogBuffer &&other) noexcept { *this = std::move(other); }
+
+    ~GLogBuffer() = default;
+
+    GLogBuffer &operator=(const GLogBuffer &other) {
+        if (this != &other) {
+            clear();
+            append(other.view());
+        }
+        return *this;
+    }
+
+    GLogBuffer &operator=(GLogBuffer &&other) noexcept {
+        if (this != &other) {
+            if (other.spilled_) {
+                overflow_ = std::move(other.overflow_);
+                spilled_ = true;
+                size_ = 0;
+            } else {
+                clear();
+                std::copy_n(other.inline_.data(), other.size_, inline_.data());
+                size_ = other.size_;
+            }
+            other.clear();
+        }
+        return *this;
+    }
+
+    void clear() {
+        size_ = 0;
+        spilled_ = false;
+        overflow_.clear();
+    }
+
+    void append(Char c) {
+        if (!spilled_ && size_ < InlineCapacity) {
+            inline_[size_++] = c;
+            return;
+        }
+        spill();
+        overflow_ += c;
+    }
+
+    void append(std::string_view text) {
+        if (!spilled_ && text.size() <= InlineCapacity - size_) {
+            std::copy(text.begin(), text.end(), inline_.data() + size_);
+            size_ += text.size();
+            return;
+        }
+        spill();
+        overflow_ += text;
+    }
+
+    Inserter inserter() { return Inserter{*this}; }
+
+    std::string_view view() const {
+        return spilled_ ? std::string_view{overflow_} : std::string_view{inline_.data(), size_};
+    }
+
+    bool spilled() const { return spilled_; }
+
+  private:
+    void spill() {
+        if (!spilled_) {
+            overflow_.assign(inline_.data(), size_);
+            spilled_ = true;
+        }
+    }
+
+    std::array<Char, InlineCapacity> inline_;
+    Size size_{0};
+    bool spilled_{false};
+    String overflow_;
+};
+
+/**
+ * @brief Output stream which writes into a GLogBuffer. Used to format log messages from operator<< without
+ * allocating a new stream and string for every log.
+ */
+template <Size InlineCapacity> class GLogStream : private std::streambuf, public std::ostream {
+  public:
+    GLogStream() : std::ostream{this}, defaultFlags_{flags()} {}
+
+    /**
+     * @brief Empties the buffer and restores the default formatting of the stream.
+     */
+    void reset() {
+        buffer_.clear();
+        clear();
+        flags(defaultFlags_);
+        precision(6);
+        width(0);
+        fill(' ');
+    }
+
+    std::string_view view() const { return buffer_.view(); }
+
+  protected:
+    using typename std::streambuf::int_type;
+    using typename std::streambuf::traits_type;
+
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            buffer_.append(traits_type::to_char_type(c));
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const Char *s, std::streamsize count) override {
+        buffer_.append(std::string_view{s, static_cast<Size>(count)});
+        return count;
+    }
+
+  private:
+    GLogBuffer<InlineCapacity> buffer_;
+    const std::ios_base::fmtflags defaultFlags_;
+};
+
+constexpr Size LogMessageCapacity = 1024;
+constexpr Size LogRecordCapacity = 256;
+
+/**
+ * @brief Static information about a place in the code which logs, captured once by the GLOG_* macros.
+ *
+ * Each call site gets a process wide unique id the first time id() is called, which e.g. the binary log
+ * format uses instead of repeating the file and function names in every record.
+ */
+class GLogCallSite {
+  public:
+    constexpr GLogCallSite(GLogSeverity severity, GLogLevel level, const Char *file, const Char *function,
+                           Integer line)
+        : severity{severity}, level{level}, file{file}, function{function}, line{line} {}
+
+    GLogCallSite(const GLogCallSite &) = delete;
+    GLogCallSite &operator=(const GLogCallSite &) = delete;
+
+    /**
+     * @brief Gives the unique id of the call site. Ids start at 1.
+     */
+    Unsigned id() const {
+        Unsigned current = id_.load(std::memory_order_acquire);
+        if (current == 0) {
+            const Unsigned assigned = nextId().fetch_add(1, std::memory_order_relaxed) + 1;
+            if (id_.compare_exchange_strong(current, assigned, std::memory_order_acq_rel)) {
+                current = assigned;
+            }
+        }
+        return current;
+    }
+
+    const GLogSeverity severity;
+    const GLogLevel level;
+    const Char *const file;
+    const Char *const function;
+    const Integer line;
+
+  private:
+    static std::atomic<Unsigned> &nextId() {
+        static std::atomic<Unsigned> counter{0};
+        return counter;
+    }
+
+    mutable std::atomic<Unsigned> id_{0};
+};
+
+/**
+ * @brief Tells if a rate limited log is written, and how many logs of the call site were suppressed since
+ * the previous written log.
+ */
+struct GLogAdmission {
+    bool admitted{false};
+    Size suppressed{0};
+
+    explicit operator bool() const { return admitted; }
+};
+
+/**
+ * @brief Per call site counters of the rate limited GLOG_*_EVERY_N, GLOG_*_EVERY_MS and GLOG_*_FIRST_N
+ * macros. All counters are lock-free, so suppressing a log costs one atomic operation and no formatting.
+ */
+class GLogRateLimiter {
+  public:
+    /**
+     * @brief Admits the first call and then every n:th call.
+     */
+    GLogAdmission everyN(Size n) {
+        n = std::max(n, Size{1});
+        const Size count = count_.fetch_add(1, std::memory_order_relaxed);
+        if (count % n != 0) {
+            return {};
+        }
+        return {true, count == 0 ? 0 : n - 1};
+    }
+
+    /**
+     * @brief Admits the first call and then at most one call per interval.
+     */
+    GLogAdmission every(std::chrono::milliseconds interval) {
+        const Ticks now = std::chrono::steady_clock::now().time_since_epoch().count();
+        const Ticks ticks = std::chrono::duration_cast<std::chrono::steady_clock::duration>(interval).count();
+
+        Ticks last = last_.load(std::memory_order_relaxed);
+        if ((last != Never && now - last < ticks) ||
+            !last_.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+            suppressed_.fetch_add(1, std::memory_order_relaxed);
+            return {};
+        }
+        return {true, suppressed_.exchange(0, std::memory_order_relaxed)};
+    }
+
+    /**
+     * @brief Admits the first n calls only.
+     */
+    GLogAdmission firstN(Size n) {
+        if (count_.load(std::memory_order_relaxed) >= n) {
+            return {};
+        }
+        return {count_.fetch_add(1, std::memory_order_relaxed) < n, 0};
+    }
+
+  private:
+    using Ticks = std::chrono::steady_clock::rep;
+    static constexpr Ticks Never = std::numeric_limits<Ticks>::min();
+
+    std::atomic<Size> count_{0};
+    std::atomic<Ticks> last_{Never};
+    std::atomic<Size> suppressed_{0};
+};
+
+/**
+ * @brief Appends a log record in the text layout of the logger to the buffer.
+ *
+ * @param timestamp The "HH:MM:SS:mmm" time of the log, see GTimestampCache, or empty to leave it out.
+ * @param message The log message, i.e. file name, function name and text.
+ * @param color Adds CoutColor codes for the severity when true.
+ */
+template <Size InlineCapacity>
+void appendLogRecord(GLogBuffer<InlineCapacity> &record, GLogSeverity severity, std::string_view timestamp,
+                     std::string_view message, bool color = true) {
+    if (severity == GLogSeverity::Info) {
+        if (!timestamp.empty()) {
+            record.append(timestamp);
+            record.append(" | ");
+        }
+        if (color) {
+            record.append(CoutColor::Green);
+        }
+        record.append("INFO: ");
+    } else {
+        if (color) {
+            record.append(CoutColor::Yellow);
+        }
+        if (!timestamp.empty()) {
+            record.append(timestamp);
+            record.append(" ");
+        }
+        record.append("WARNING: ");
+    }
+    if (color) {
+        record.append(CoutColor::Reset);
+    }
+    record.append(message);
+}
+
+} // namespace gbase
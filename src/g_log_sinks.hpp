@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "g_basic_types.hpp"
+#include "g_log_record.hpp"
+#include "g_time.hpp"
+
+namespace gbase {
+
+/**
+ * @brief A formatted log as it is handed to the log sinks. Each sink lays out the record itself, e.g. with
+ * or without color codes, but the message is formatted only once for all sinks.
+ */
+struct GLogEntry {
+    GLogSeverity severity{GLogSeverity::Info};
+    std::string_view timestamp; ///< The "HH:MM:SS:mmm" time of the log, or empty to leave it out.
+    std::string_view message; ///< File name, function name and text of the log.
+};
+
+/**
+ * @brief Interface of the log outputs of GLogger.
+ *
+ * write() may be called from several threads at the same time, unless the logger is in asynchronous mode
+ * where only the writer thread calls the sinks.
+ */
+class GLogSink {
+  public:
+    virtual ~GLogSink() = default;
+
+    /**
+     * @brief Writes a log as one line.
+     */
+    virtual void write(const GLogEntry &entry) = 0;
+
+    /**
+     * @brief Makes the written logs visible to readers of the output.
+     */
+    virtual void flush() = 0;
+};
+
+/**
+ * @brief Writes logs to a std::ostream, e.g. std::cout. Each log is formatted on the calling thread and
+ * written under a lock, so lines from concurrent callers do not interleave.
+ */
+class GStreamLogSink : public GLogSink {
+  public:
+    /**
+     * @param color Adds CoutColor codes for the severity when true.
+     */
+    explicit GStreamLogSink(std::ostream &target, bool color = true) : target_{target}, color_{color} {}
+
+    void write(const GLogEntry &entry) override {
+        static thread_local GLogBuffer<LogMessageCapacity + LogRecordCapacity> record;
+        record.clear();
+        appendLogRecord(record, entry.severity, entry.timestamp, entry.message, color_);
+        record.append('\n');
+
+        std::lock_guard lock{mutex_};
+        target_.write(record.view().data(), static_cast<std::streamsize>(record.view().size()));
+    }
+
+    void flush() override {
+        std::lock_guard lock{mutex_};
+        target_.flush();
+    }
+
+  private:
+    std::mutex mutex_;
+    std::ostream &target_;
+    const bool color_;
+};
+
+/**
+ * @brief Discards all logs, e.g. to measure the cost of logging without any output.
+ */
+class GNullLogSink : public GLogSink {
+  public:
+    void write(const GLogEntry &) override {}
+    void flush() override {}
+};
+
+/**
+ * @brief Fans out each log to a number of sinks.
+ */
+class GLogSinkGroup : public GLogSink {
+  public:
+    GLogSinkGroup() = default;
+
+    explicit GLogSinkGroup(std::vector<std::shared_ptr<GLogSink>> sinks) : sinks_{std::move(sinks)} {}
+
+    void add(std::shared_ptr<GLogSink> sink) { sinks_.push_back(std::move(sink)); }
+
+    void remove(const std::shared_ptr<GLogSink> &sink) { std::erase(sinks_, sink); }
+
+    void clear() { sinks_.clear(); }
+
+    const std::vector<std::shared_ptr<GLogSink>> &sinks() const { return sinks_; }
+
+    void write(const GLogEntry &entry) override {
+        for (const auto &sink : sinks_) {
+            sink->write(entry);
+        }
+    }
+
+    void flush() override {
+        for (const auto &sink : sinks_) {
+            sink->flush();
+        }
+    }
+
+  private:
+    std::vector<std::shared_ptr<GLogSink>> sinks_;
+};
+
+} // namespace gbase
@@ -1,10 +1,24 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <format>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include "g_basic_types.hpp"
+#include "g_circular_buffers.hpp"
+#include "g_log_binary.hpp"
+#include "g_log_record.hpp"
+#include "g_log_sinks.hpp"
+#include "g_pattern_matcher.hpp"
 #include "g_print_tools.hpp"
 #include "g_string_tools.hpp"
 #include "g_time.hpp"
@@ -13,6 +27,159 @@ using namespace std;
 
 namespace gbase {
 
+/**
+ * @brief A log waiting in the queue of GAsyncLogWriter. Owns a copy of the message of a GLogEntry.
+ */
+struct GLogRecord {
+    GLogRecord() = default;
+
+    explicit GLogRecord(const GLogEntry &entry)
+        : severity{entry.severity}, timestamp{entry.timestamp}, message{entry.message} {}
+
+    GLogEntry entry() const { return {severity, timestamp.view(), message.view()}; }
+
+    GLogSeverity severity{GLogSeverity::Info};
+    GLogBuffer<GTimestampCache::Length> timestamp;
+    GLogBuffer<LogRecordCapacity> message;
+};
+
+/**
+ * @brief Tells what happens to a log record when the queue of the asynchronous log writer is full.
+ */
+enum class GLogOverflowPolicy {
+    Block,      ///< The logging thread waits until the writer has made room for the record.
+    DropNewest, ///< The new record is discarded.
+    DropOldest  ///< The oldest queued record is discarded to make room for the new record.
+};
+
+/**
+ * @brief Writes formatted logs to a log sink from a background thread.
+ *
+ * Producers push records into a bounded lock-free queue, and the writer thread drains the queue in batches
+ * and flushes the sink once per batch instead of once per record.
+ */
+class GAsyncLogWriter {
+  public:
+    static constexpr Size DefaultCapacity = 8192;
+    static constexpr Size MaxBatchSize = 256;
+
+    explicit GAsyncLogWriter(GLogSink &target, Size capacity = DefaultCapacity,
+                             GLogOverflowPolicy policy = GLogOverflowPolicy::Block)
+        : target_{target}, queue_{capacity}, policy_{policy}, writer_{[this] { run(); }} {}
+
+    GAsyncLogWriter(const GAsyncLogWriter &) = delete;
+    GAsyncLogWriter &operator=(const GAsyncLogWriter &) = delete;
+
+    /**
+     * @brief Writes all queued records and stops the writer thread.
+     */
+    ~GAsyncLogWriter() {
+        stopping_.store(true, std::memory_order_release);
+        wakeWriter();
+        writer_.join();
+    }
+
+    /**
+     * @brief Queues a copy of the log. The log is written as a separate line.
+     */
+    void push(const GLogEntry &entry) {
+        GLogRecord record{entry};
+
+        switch (policy_) {
+        case GLogOverflowPolicy::Block:
+            while (!queue_.tryPush(std::move(record))) {
+                std::this_thread::yield();
+            }
+            break;
+
+        case GLogOverflowPolicy::DropNewest:
+            if (!queue_.tryPush(std::move(record))) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            break;
+
+        case GLogOverflowPolicy::DropOldest:
+            while (!queue_.tryPush(std::move(record))) {
+                GLogRecord discarded;
+                if (queue_.tryPop(discarded)) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            break;
+        }
+
+        wakeWriter();
+    }
+
+    /**
+     * @brief Blocks until all records pushed before the call have been written or dropped, and the sink has
+     * been flushed after writing them. Records pushed during the call are not waited for.
+     */
+    void flush() {
+        const Size target = queue_.pushCount();
+        for (Size flushed = flushedCount_.load(std::memory_order_acquire); flushed < target;
+             flushed = flushedCount_.load(std::memory_order_acquire)) {
+            flushedCount_.wait(flushed, std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Gives the number of records discarded by the overflow policy.
+     */
+    Size droppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+    constexpr GLogOverflowPolicy overflowPolicy() const { return policy_; }
+
+  private:
+    void run() {
+        GLogRecord record;
+
+        for (;;) {
+            const Unsigned signal = signal_.load(std::memory_order_acquire);
+
+            Size written{0};
+            while (written < MaxBatchSize && queue_.tryPop(record)) {
+                target_.write(record.entry());
+                ++written;
+            }
+
+            if (written != 0) {
+                target_.flush();
+                // The records before this position were written above or dropped by a DropOldest push.
+                flushedCount_.store(queue_.popCount(), std::memory_order_release);
+                flushedCount_.notify_all();
+                continue;
+            }
+
+            if (stopping_.load(std::memory_order_acquire)) {
+                return;
+            }
+
+            signal_.wait(signal, std::memory_order_acquire);
+        }
+    }
+
+    void wakeWriter() {
+        signal_.fetch_add(1, std::memory_order_release);
+        signal_.notify_one();
+    }
+
+    GLogSink &target_;
+    GRingBuffer<GLogRecord> queue_;
+    const GLogOverflowPolicy policy_;
+    std::atomic<Size> flushedCount_{0};
+    std::atomic<Size> dropped_{0};
+    std::atomic<Unsigned> signal_{0};
+    std::atomic<bool> stopping_{false};
+    std::thread writer_;
+};
+
+/**
+ * @brief Tells if a temporary log setting applies to the whole process or only to the calling thread.
+ */
+enum class GLogScope { Process, Thread };
+
 /**
  * @brief Singleton class which can be used to handle application logging.
  *
@@ -27,10 +194,40 @@ namespace gbase {
  * GLOG_DETAILS("Adding chord: ", chord);
  * @endcode
  *
+ * By default the logs are written to std::cout by the logging thread. enableAsync() moves the writing to a
+ * background thread:
+ *
+ * @code
+ * logger.enableAsync(4096, gbase::GLogOverflowPolicy::DropOldest);
+ * // ...
+ * logger.flush(); // Before shutdown.
+ * @endcode
+ *
+ * The logs are written to log sinks, see GLogSink. By default there is one sink writing to std::cout. Each
+ * message is formatted once and handed to all sinks:
+ *
+ * @code
+ * logger.addSink(std::make_shared<gbase::GMappedFileLogSink>(gbase::GLogFileOptions{.basePath = "app"}));
+ * @endcode
+ *
+ * The log level, the filter and the flags can be changed while other threads are logging. Logging threads
+ * read them without locking: the level and flags are atomics, and the filter is published as an immutable
+ * snapshot. Each thread can also override the level and the filter for itself, see setThreadLogLevel() and
+ * setThreadFilter().
+ *
  */
 class GLogger {
   public:
-    enum class LogLevel { None, Normal, Details };
+    using LogLevel = GLogLevel;
+    using Severity = GLogSeverity;
+
+    /**
+     * @brief Tells which part of a log is searched for the filter triggers.
+     */
+    enum class FilterScope {
+        Message, ///< The file name, the function name and the text of the log message.
+        Context  ///< Only the file name and the function name, so rejected messages are never formatted.
+    };
 
     /**
      * @brief Gives acccess to the singleton instance of the logger.
@@ -40,7 +237,99 @@ class GLogger {
         return instance;
     }
 
-    void showTimestamp(bool show) { timestamp_ = show; }
+    ~GLogger() { disableAsync(); }
+
+    /**
+     * @brief Adds a sink which all logs are written to. The sinks should be set up before other threads
+     * start logging.
+     */
+    void addSink(std::shared_ptr<GLogSink> sink) {
+        changeSinks([&] { sinks_.add(std::move(sink)); });
+    }
+
+    /**
+     * @brief Removes a sink added by addSink(), or the console sink. Waiting logs are written first.
+     */
+    void removeSink(const std::shared_ptr<GLogSink> &sink) {
+        changeSinks([&] { sinks_.remove(sink); });
+    }
+
+    /**
+     * @brief Gives the sinks which the logs are written to.
+     */
+    const vector<std::shared_ptr<GLogSink>> &sinks() const { return sinks_.sinks(); }
+
+    /**
+     * @brief Gives the default sink writing to std::cout, e.g. to remove it with removeSink().
+     */
+    const std::shared_ptr<GLogSink> &consoleSink() const { return consoleSink_; }
+
+    /**
+     * @brief Sets if the logs start with the time of day. Default is true. The timestamp comes from
+     * GTimestampCache, so GTimestampCache::startTicker() takes the clock reads off the logging threads too.
+     */
+    void showTimestamp(bool show) { timestamp_.store(show, std::memory_order_relaxed); }
+
+    /**
+     * @brief Makes the logger hand over formatted logs to a background writer thread instead of writing
+     * them to the sinks on the logging thread. Should be called before other threads start logging.
+     *
+     * @param capacity The maximum number of logs waiting to be written.
+     * @param policy Tells what happens with new logs when capacity logs are already waiting.
+     */
+    void enableAsync(Size capacity = GAsyncLogWriter::DefaultCapacity,
+                     GLogOverflowPolicy policy = GLogOverflowPolicy::Block) {
+        disableAsync();
+        asyncWriter_ = std::make_unique<GAsyncLogWriter>(sinks_, capacity, policy);
+        asyncCapacity_ = capacity;
+    }
+
+    /**
+     * @brief Writes all waiting logs and returns to writing logs on the logging thread.
+     */
+    void disableAsync() { asyncWriter_.reset(); }
+
+    /**
+     * @brief Tells if the logs are written by a background writer thread.
+     */
+    bool isAsync() const { return asyncWriter_ != nullptr; }
+
+    /**
+     * @brief Blocks until all logs have been written to the sinks or to the binary log file.
+     */
+    void flush() {
+        if (asyncWriter_) {
+            asyncWriter_->flush();
+        } else {
+            sinks_.flush();
+        }
+        if (binaryWriter_) {
+            binaryWriter_->flush();
+        }
+    }
+
+    /**
+     * @brief Makes the GLOG_* macros write compact binary records to given file instead of text, see
+     * GBinaryLogWriter. Should be called before other threads start logging.
+     *
+     * The messages are not formatted in this mode, so only filters with FilterScope::Context apply.
+     */
+    void enableBinaryOutput(const GPath &path) { binaryWriter_ = std::make_unique<GBinaryLogWriter>(path); }
+
+    /**
+     * @brief Closes the binary log file and returns to text logging.
+     */
+    void disableBinaryOutput() { binaryWriter_.reset(); }
+
+    /**
+     * @brief Tells if the GLOG_* macros write to a binary log file.
+     */
+    bool isBinaryOutput() const { return binaryWriter_ != nullptr; }
+
+    /**
+     * @brief Gives the number of logs discarded by the overflow policy of the asynchronous mode.
+     */
+    Size droppedCount() const { return asyncWriter_ ? asyncWriter_->droppedCount() : 0; }
 
     /**
      * @brief Set the logging level. Default is LogLevel::Normal.
@@ -48,12 +337,33 @@ class GLogger {
      * @param logLevel LogLevel::None: No logging is performed. LogLevel::Normal: INFO logs and WARNING logs
      * are logged. LogLevel::Details. INFO logs, WARNING logs and DETAILED logs are logged.
      */
-    constexpr void setLogLevel(LogLevel logLevel) { currentLogLevel_ = logLevel; }
+    void setLogLevel(LogLevel logLevel) { currentLogLevel_.store(logLevel, std::memory_order_relaxed); }
 
     /**
-     * @brief Gives the current log level.
+     * @brief Gives the log level of the calling thread, i.e. the level set by setThreadLogLevel() if any,
+     * otherwise the level set by setLogLevel().
      */
-    constexpr LogLevel currentLogLevel() const { return currentLogLevel_; }
+    LogLevel currentLogLevel() const {
+        const ThreadState &state = threadState();
+        return state.levelOverride ? *state.levelOverride : currentLogLevel_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gives the log level set by setLogLevel(), ignoring any override of the calling thread.
+     */
+    LogLevel processLogLevel() const { return currentLogLevel_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Overrides the log level for the calling thread only.
+     *
+     * @param logLevel The level of the thread, or std::nullopt to follow the process wide level again.
+     */
+    void setThreadLogLevel(std::optional<LogLevel> logLevel) { threadState().levelOverride = logLevel; }
+
+    /**
+     * @brief Gives the log level override of the calling thread, if any.
+     */
+    std::optional<LogLevel> threadLogLevel() const { return threadState().levelOverride; }
 
     /**
      * @brief Applies a filter to which logs are logged.
@@ -62,7 +372,12 @@ class GLogger {
      * by this method or setFilter - will be logged. The 'context' includes filename, method/function name or
      * any test in the log message.
      */
-    constexpr void addFilter(const String &trigger) { logFilter_.emplace_back(trigger); }
+    void addFilter(const String &trigger) {
+        std::lock_guard lock{filterMutex_};
+        auto filter = processFilter();
+        filter.emplace_back(trigger);
+        publishFilter(filter);
+    }
 
     /**
      * @brief Sets the log filter.
@@ -71,17 +386,70 @@ class GLogger {
      * added by this method or setFilter - will be logged. The 'context' includes filename, method/function
      * name or any test in the log message.
      */
-    constexpr void setFilter(const vector<String> &filter) { logFilter_ = filter; }
+    void setFilter(const vector<String> &filter) {
+        std::lock_guard lock{filterMutex_};
+        publishFilter(filter);
+    }
 
     /**
      * @brief Clears the log filter.
      */
-    constexpr void clearFilter() { logFilter_.clear(); }
+    void clearFilter() {
+        std::lock_guard lock{filterMutex_};
+        publishFilter({});
+    }
+
+    /**
+     * @brief Returns the log filter of the calling thread, i.e. the filter set by setThreadFilter() if any,
+     * otherwise the filter set by setFilter() and addFilter().
+     */
+    vector<String> currentFilter() const {
+        const GPatternMatcher *filter = activeFilter();
+        return filter ? filter->patterns() : vector<String>{};
+    }
+
+    /**
+     * @brief Returns the filter set by setFilter() and addFilter(), ignoring any override of the calling
+     * thread.
+     */
+    vector<String> processFilter() const {
+        const auto filter = filter_.load(std::memory_order_acquire);
+        return filter ? filter->patterns() : vector<String>{};
+    }
+
+    /**
+     * @brief Overrides the log filter for the calling thread only.
+     *
+     * @param filter The filter of the thread - an empty filter lets all logs through - or std::nullopt to
+     * follow the process wide filter again.
+     */
+    void setThreadFilter(const std::optional<vector<String>> &filter) {
+        ThreadState &state = threadState();
+        state.hasFilterOverride = filter.has_value();
+        state.filterOverride = filter ? compileFilter(*filter) : nullptr;
+    }
+
+    /**
+     * @brief Gives the log filter override of the calling thread, if any.
+     */
+    std::optional<vector<String>> threadFilter() const {
+        const ThreadState &state = threadState();
+        if (!state.hasFilterOverride) {
+            return std::nullopt;
+        }
+        return state.filterOverride ? state.filterOverride->patterns() : vector<String>{};
+    }
+
+    /**
+     * @brief Sets which part of the logs the filter triggers are searched in. Default is
+     * FilterScope::Message.
+     */
+    void setFilterScope(FilterScope scope) { filterScope_.store(scope, std::memory_order_relaxed); }
 
     /**
-     * @brief Returns the current log fileter.
+     * @brief Gives the current filter scope.
      */
-    constexpr auto currentFilter() const { return logFilter_; }
+    FilterScope currentFilterScope() const { return filterScope_.load(std::memory_order_relaxed); }
 
     /**
      * @brief Logs an information message. See also the LOG_INFO macro.
@@ -89,19 +457,8 @@ class GLogger {
      * @param message The log message.
      * @param logLevel The log will only be captured if logLevel is less or equal to currentLogLevel().
      */
-    constexpr void info(const String &message, LogLevel logLevel = LogLevel::Normal) {
-        if (logLevel > currentLogLevel_)
-            return;
-
-        if (matchLogFilter(message)) {
-            if (timestamp_) {
-                cout << gbase::GUTCTime::now().timeOfDay().toString() << " | ";
-            }
-            cout << CoutColor::Green;
-            cout << "INFO: ";
-            cout << CoutColor::Reset;
-            cout << message << endl;
-        }
+    void info(std::string_view message, LogLevel logLevel = LogLevel::Normal) {
+        log(Severity::Info, logLevel, message);
     }
 
     /**
@@ -110,38 +467,220 @@ class GLogger {
      * @param message The log message.
      * @param logLevel The log will only be captured if logLevel is less or equal to currentLogLevel().
      */
-    constexpr void warning(const String &message, LogLevel logLevel = LogLevel::Normal) {
-        if (logLevel > currentLogLevel_)
+    void warning(std::string_view message, LogLevel logLevel = LogLevel::Normal) {
+        log(Severity::Warning, logLevel, message);
+    }
+
+    /**
+     * @brief Logs the file name, the function name and the args concatenated with operator<<. Used by the
+     * GLOG_* macros. The message is built in a per-thread stream, see MessageLease, so no memory is allocated
+     * unless the message is longer than LogMessageCapacity.
+     */
+    template <typename... Args> void logConcat(const GLogCallSite &site, const Args &...args) {
+        if (!matchContextFilter(site.file, site.function)) {
+            return;
+        }
+
+        if (binaryWriter_) {
+            binaryWriter_->write(site, {}, args...);
+            return;
+        }
+
+        MessageLease<GLogStream<LogMessageCapacity>> lease;
+        auto &stream = lease.message();
+        stream.reset();
+        stream << site.file << " | " << site.function << " | ";
+        (stream << ... << args);
+        log(site.severity, site.level, stream.view());
+    }
+
+    /**
+     * @brief Logs the file name, the function name and a message formatted with std::format. Used by the
+     * GLOG_*_FMT macros. The message is built in a per-thread buffer, see MessageLease, so no memory is
+     * allocated unless the message is longer than LogMessageCapacity.
+     */
+    template <typename... Args>
+    void logFormat(const GLogCallSite &site, std::format_string<Args...> format, Args &&...args) {
+        if (!matchContextFilter(site.file, site.function)) {
             return;
+        }
 
-        if (matchLogFilter(message)) {
-            cout << CoutColor::Yellow;
-            cout << timestamp_ ? (gbase::GUTCTime::now().timeOfDay().toString() + " ") : "";
-            cout << "WARNING: ";
-            cout << CoutColor::Reset;
-            cout << message << endl;
+        if (binaryWriter_) {
+            binaryWriter_->write(site, format.get(), args...);
+            return;
+        }
+
+        MessageLease<GLogBuffer<LogMessageCapacity>> lease;
+        auto &buffer = lease.message();
+        buffer.clear();
+        buffer.append(site.file);
+        buffer.append(" | ");
+        buffer.append(site.function);
+        buffer.append(" | ");
+        std::format_to(buffer.inserter(), format, std::forward<Args>(args)...);
+        log(site.severity, site.level, buffer.view());
+    }
+
+    /**
+     * @brief Logs "Suppressed <count> similar messages" for a call site, unless the count is zero. Used by
+     * the rate limited GLOG_* macros before the next admitted log of the call site.
+     */
+    void logSuppressed(const GLogCallSite &site, Size suppressed) {
+        if (suppressed != 0) {
+            logConcat(site, "Suppressed ", suppressed, " similar messages");
         }
     }
 
   private:
-    constexpr bool matchLogFilter(const String &context) const {
-        if (logFilter_.empty()) {
-            return true;
+    using FilterSnapshot = std::shared_ptr<const GPatternMatcher>;
+
+    /**
+     * @brief Lends the per-thread stream or buffer in which logConcat() and logFormat() build messages. There
+     * is one per thread and message type, shared by all instantiations of the log functions. A log made while
+     * it is lent, e.g. from the operator<< of a log argument, builds its message in a local one instead.
+     */
+    template <typename Message> class MessageLease {
+      public:
+        MessageLease() : slot_{threadSlot()} {
+            if (slot_.lent) {
+                nested_.emplace();
+            } else {
+                slot_.lent = true;
+            }
         }
 
-        bool match = false;
-        for (const auto &f : logFilter_) {
-            if (context.contains(f)) {
-                match = true;
-                break;
+        MessageLease(const MessageLease &) = delete;
+        MessageLease &operator=(const MessageLease &) = delete;
+
+        ~MessageLease() {
+            if (!nested_) {
+                slot_.lent = false;
             }
         }
-        return match;
+
+        Message &message() { return nested_ ? *nested_ : slot_.message; }
+
+      private:
+        struct Slot {
+            Message message;
+            bool lent{false};
+        };
+
+        static Slot &threadSlot() {
+            static thread_local Slot slot;
+            return slot;
+        }
+
+        Slot &slot_;
+        std::optional<Message> nested_;
+    };
+
+    /**
+     * @brief Log settings of one thread. cachedFilter keeps the last seen process filter snapshot, so the
+     * shared snapshot is only loaded again when filterVersion_ has changed.
+     */
+    struct ThreadState {
+        std::optional<LogLevel> levelOverride;
+        bool hasFilterOverride{false};
+        FilterSnapshot filterOverride;
+        FilterSnapshot cachedFilter;
+        Unsigned cachedFilterVersion{0};
+    };
+
+    static ThreadState &threadState() {
+        static thread_local ThreadState state;
+        return state;
+    }
+
+    /**
+     * @brief Applies a change to sinks_ while no writer thread is running.
+     */
+    template <typename Change> void changeSinks(Change &&change) {
+        if (!asyncWriter_) {
+            sinks_.flush();
+            change();
+            return;
+        }
+
+        const auto policy = asyncWriter_->overflowPolicy();
+        disableAsync();
+        change();
+        enableAsync(asyncCapacity_, policy);
+    }
+
+    static FilterSnapshot compileFilter(const vector<String> &filter) {
+        return filter.empty() ? nullptr : std::make_shared<const GPatternMatcher>(filter);
+    }
+
+    /**
+     * @brief Publishes a new process wide filter. The caller must hold filterMutex_.
+     */
+    void publishFilter(const vector<String> &filter) {
+        filter_.store(compileFilter(filter), std::memory_order_release);
+        filterVersion_.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Gives the filter of the calling thread, or nullptr if all logs pass.
+     */
+    const GPatternMatcher *activeFilter() const {
+        ThreadState &state = threadState();
+        if (state.hasFilterOverride) {
+            return state.filterOverride.get();
+        }
+
+        const Unsigned version = filterVersion_.load(std::memory_order_acquire);
+        if (version != state.cachedFilterVersion) {
+            state.cachedFilter = filter_.load(std::memory_order_acquire);
+            state.cachedFilterVersion = version;
+        }
+        return state.cachedFilter.get();
+    }
+
+    void log(Severity severity, LogLevel logLevel, std::string_view message) {
+        if (logLevel > currentLogLevel())
+            return;
+
+        if (currentFilterScope() == FilterScope::Message && !matchLogFilter(message)) {
+            return;
+        }
+
+        const std::string_view timestamp =
+            timestamp_.load(std::memory_order_relaxed) ? GTimestampCache::now() : std::string_view{};
+
+        const GLogEntry entry{severity, timestamp, message};
+        if (asyncWriter_) {
+            asyncWriter_->push(entry);
+            return;
+        }
+        sinks_.write(entry);
+        sinks_.flush();
     }
 
-    LogLevel currentLogLevel_ = LogLevel::Normal;
-    vector<String> logFilter_;
-    bool timestamp_{true};
+    bool matchLogFilter(std::string_view context) const {
+        const GPatternMatcher *filter = activeFilter();
+        return filter == nullptr || filter->matchesAny(context);
+    }
+
+    bool matchContextFilter(const Char *file, const Char *function) const {
+        if (currentFilterScope() == FilterScope::Message) {
+            return true;
+        }
+        const GPatternMatcher *filter = activeFilter();
+        return filter == nullptr || filter->matchesAny({file, " | ", function, " | "});
+    }
+
+    std::atomic<LogLevel> currentLogLevel_{LogLevel::Normal};
+    std::atomic<FilterSnapshot> filter_;
+    std::atomic<Unsigned> filterVersion_{0};
+    std::mutex filterMutex_;
+    std::atomic<FilterScope> filterScope_{FilterScope::Message};
+    std::atomic<bool> timestamp_{true};
+    std::shared_ptr<GLogSink> consoleSink_{std::make_shared<GStreamLogSink>(cout)};
+    GLogSinkGroup sinks_{{consoleSink_}};
+    Size asyncCapacity_{GAsyncLogWriter::DefaultCapacity};
+    std::unique_ptr<GAsyncLogWriter> asyncWriter_;
+    std::unique_ptr<GBinaryLogWriter> binaryWriter_;
 };
 
 /**
@@ -151,45 +690,144 @@ class GLogger {
  * Example usage:
  * @code
  * {
- *   GLocalLogLevel(GLogger::LogLevel::None);
+ *   GLocalLogLevel localLogLevel(GLogger::LogLevel::None);
  *   // No logging in this scope.
  * }
  * // Logging will return to global log level setting setting here
  * @endcode
  *
+ * With GLogScope::Thread only the calling thread is affected, which is what worker threads should use.
  */
 class GLocalLogLevel {
   public:
-    GLocalLogLevel(GLogger::LogLevel localLogLevel) {
-        previousLogLevel_ = GLogger::getInstance().currentLogLevel();
-        GLogger::getInstance().setLogLevel(localLogLevel);
+    GLocalLogLevel(GLogger::LogLevel localLogLevel, GLogScope scope = GLogScope::Process) : scope_{scope} {
+        GLogger &logger = GLogger::getInstance();
+        if (scope_ == GLogScope::Thread) {
+            previousThreadLogLevel_ = logger.threadLogLevel();
+            logger.setThreadLogLevel(localLogLevel);
+        } else {
+            previousLogLevel_ = logger.processLogLevel();
+            logger.setLogLevel(localLogLevel);
+        }
     }
 
-    ~GLocalLogLevel() { GLogger::getInstance().setLogLevel(previousLogLevel_); }
+    ~GLocalLogLevel() {
+        GLogger &logger = GLogger::getInstance();
+        if (scope_ == GLogScope::Thread) {
+            logger.setThreadLogLevel(previousThreadLogLevel_);
+        } else {
+            logger.setLogLevel(previousLogLevel_);
+        }
+    }
 
   private:
-    GLogger::LogLevel previousLogLevel_;
+    GLogScope scope_;
+    GLogger::LogLevel previousLogLevel_{GLogger::LogLevel::Normal};
+    std::optional<GLogger::LogLevel> previousThreadLogLevel_;
 };
 
 /**
  * @brief Help class to temporary change the current log filter within the current scope. The previous log
  * filter is restored when the class instance is destroyed.
+ *
+ * With GLogScope::Thread only the calling thread is affected, which is what worker threads should use.
  */
 class GLocalLogFilter {
   public:
-    GLocalLogFilter(GLogger::LogLevel localLogLevel) {
-        previousLogFilter_ = GLogger::getInstance().currentFilter();
-        GLogger::getInstance().setLogLevel(localLogLevel);
+    GLocalLogFilter(const vector<String> &localFilter, GLogScope scope = GLogScope::Process) : scope_{scope} {
+        GLogger &logger = GLogger::getInstance();
+        if (scope_ == GLogScope::Thread) {
+            previousThreadLogFilter_ = logger.threadFilter();
+            logger.setThreadFilter(localFilter);
+        } else {
+            previousLogFilter_ = logger.processFilter();
+            logger.setFilter(localFilter);
+        }
     }
 
-    ~GLocalLogFilter() { GLogger::getInstance().setFilter(previousLogFilter_); }
+    ~GLocalLogFilter() {
+        GLogger &logger = GLogger::getInstance();
+        if (scope_ == GLogScope::Thread) {
+            logger.setThreadFilter(previousThreadLogFilter_);
+        } else {
+            logger.setFilter(previousLogFilter_);
+        }
+    }
 
   private:
+    GLogScope scope_;
     vector<String> previousLogFilter_;
+    std::optional<vector<String>> previousThreadLogFilter_;
 };
 
 } // namespace gbase
 
+/**
+ * @def GBASE_LOG_COMPILED_LEVEL
+ * @brief The most detailed log level which is compiled into the application: 0 = LogLevel::None, 1 =
+ * LogLevel::Normal, 2 = LogLevel::Details. Set by the meson option 'log_level'.
+ *
+ * GLOG_* macros with a more detailed level than this expand to an empty statement, and their arguments are
+ * never evaluated.
+ */
+#ifndef GBASE_LOG_COMPILED_LEVEL
+#define GBASE_LOG_COMPILED_LEVEL 2
+#endif
+
+#if GBASE_LOG_COMPILED_LEVEL < 0 || GBASE_LOG_COMPILED_LEVEL > 2
+#error "GBASE_LOG_COMPILED_LEVEL must be 0 (None), 1 (Normal) or 2 (Details)."
+#endif
+
+/**
+ * @def GLOG_MESSAGE(severity, level, ...)
+ * @brief Help macro to the GLOG_* macros. Formats the log message only if the level is enabled at runtime.
+ */
+#define GLOG_MESSAGE(severity, level, ...)                                                                   \
+    do {                                                                                                     \
+        if (gbase::GLogger::getInstance().currentLogLevel() >= level) {                                      \
+            static const gbase::GLogCallSite glogCallSite{severity, level, __FILE__, __func__, __LINE__};    \
+            gbase::GLogger::getInstance().logConcat(glogCallSite, __VA_ARGS__);                              \
+        }                                                                                                    \
+    } while (false)
+
+/**
+ * @def GLOG_FORMAT(severity, level, ...)
+ * @brief Help macro to the GLOG_*_FMT macros. Formats the log message only if the level is enabled at
+ * runtime.
+ */
+#define GLOG_FORMAT(severity, level, ...)                                                                    \
+    do {                                                                                                     \
+        if (gbase::GLogger::getInstance().currentLogLevel() >= level) {                                      \
+            static const gbase::GLogCallSite glogCallSite{severity, level, __FILE__, __func__, __LINE__};    \
+            gbase::GLogger::getInstance().logFormat(glogCallSite, __VA_ARGS__);                              \
+        }                                                                                                    \
+    } while (false)
+
+/**
+ * @def GLOG_LIMITED(logFunction, severity, level, admit, ...)
+ * @brief Help macro to the rate limited GLOG_* macros. Each call site has its own GLogRateLimiter, and
+ * admit is the limiter method which decides if the log is written.
+ */
+#define GLOG_LIMITED(logFunction, severity, level, admit, ...)                                               \
+    do {                                                                                                     \
+        if (gbase::GLogger::getInstance().currentLogLevel() >= level) {                                      \
+            static const gbase::GLogCallSite glogCallSite{severity, level, __FILE__, __func__, __LINE__};    \
+            static gbase::GLogRateLimiter glogRateLimiter;                                                   \
+            if (const gbase::GLogAdmission glogAdmission = glogRateLimiter.admit) {                          \
+                gbase::GLogger::getInstance().logSuppressed(glogCallSite, glogAdmission.suppressed);         \
+                gbase::GLogger::getInstance().logFunction(glogCallSite, __VA_ARGS__);                        \
+            }                                                                                                \
+        }                                                                                                    \
+    } while (false)
+
+/**
+ * @def GLOG_DISABLED(...)
+ * @brief Help macro to the GLOG_* macros. Used for log levels which are not compiled in.
+ */
+#define GLOG_DISABLED(...)                                                                                   \
+    do {                                                                                                     \
+    } while (false)
+
 /**
  * @def GLOG_INFO(...)
  * @brief Captures the file name, the method/function name and given parameters in an info log message with
@@ -200,13 +838,6 @@ class GLocalLogFilter {
  * GLOG_INFO("The log level was set to: ", logLevel);
  * @endcode
  */
-#define GLOG_INFO(...)                                                                                       \
-    if (gbase::GLogger::getInstance().currentLogLevel() >= gbase::GLogger::LogLevel::Normal) {               \
-        std::ostringstream oss;                                                                              \
-        oss << __FILE__ << " | " << __func__ << " | ";                                                       \
-        oss << gbase::concatToString(__VA_ARGS__);                                                           \
-        gbase::GLogger::getInstance().info(oss.str(), gbase::GLogger::LogLevel::Normal);                     \
-    }
 
 /**
  * @def GLOG_DETAILS(...)
@@ -218,13 +849,6 @@ class GLocalLogFilter {
  * GLOG_DETAILS("Log message: ", message);
  * @endcode
  */
-#define GLOG_DETAILS(...)                                                                                    \
-    if (gbase::GLogger::getInstance().currentLogLevel() >= gbase::GLogger::LogLevel::Details) {              \
-        std::ostringstream oss;                                                                              \
-        oss << __FILE__ << " | " << __func__ << " | ";                                                       \
-        oss << gbase::concatToString(__VA_ARGS__);                                                           \
-        gbase::GLogger::getInstance().info(oss.str(), gbase::GLogger::LogLevel::Details);                    \
-    }
 
 /**
  * @def GLOG_WARNING(...)
@@ -233,13 +857,137 @@ class GLocalLogFilter {
  *
  * Example usage:
  * @code
- * GLOG_DETAILS("Log message: ", message);
+ * GLOG_WARNING("Could not open: ", fileName);
  * @endcode
  */
+
+/**
+ * @def GLOG_INFO_FMT(format, ...)
+ * @brief Like GLOG_INFO, but the message is formatted with std::format.
+ *
+ * Example usage:
+ * @code
+ * GLOG_INFO_FMT("Chords in database: {}", db.size());
+ * @endcode
+ */
+
+/**
+ * @def GLOG_DETAILS_FMT(format, ...)
+ * @brief Like GLOG_DETAILS, but the message is formatted with std::format.
+ */
+
+/**
+ * @def GLOG_WARNING_FMT(format, ...)
+ * @brief Like GLOG_WARNING, but the message is formatted with std::format.
+ */
+
+/**
+ * @def GLOG_WARNING_EVERY_N(n, ...)
+ * @brief Like GLOG_WARNING, but only the first call and then every n:th call of the call site is logged.
+ * Each logged message is preceded by "Suppressed <count> similar messages" when calls were skipped.
+ *
+ * There are EVERY_N variants of all GLOG_* macros, e.g. GLOG_INFO_EVERY_N and GLOG_WARNING_FMT_EVERY_N.
+ *
+ * Example usage:
+ * @code
+ * GLOG_WARNING_EVERY_N(1000, "Could not connect to: ", host);
+ * @endcode
+ */
+
+/**
+ * @def GLOG_WARNING_EVERY_MS(interval, ...)
+ * @brief Like GLOG_WARNING, but at most one call per interval milliseconds of the call site is logged. Each
+ * logged message is preceded by "Suppressed <count> similar messages" when calls were skipped.
+ *
+ * There are EVERY_MS variants of all GLOG_* macros, e.g. GLOG_INFO_EVERY_MS and GLOG_WARNING_FMT_EVERY_MS.
+ *
+ * Example usage:
+ * @code
+ * GLOG_WARNING_EVERY_MS(5000, "Could not connect to: ", host);
+ * @endcode
+ */
+
+/**
+ * @def GLOG_WARNING_FIRST_N(n, ...)
+ * @brief Like GLOG_WARNING, but only the first n calls of the call site are logged.
+ *
+ * There are FIRST_N variants of all GLOG_* macros, e.g. GLOG_INFO_FIRST_N and GLOG_WARNING_FMT_FIRST_N.
+ */
+
+#define GLOG_INFO_LIMITED(logFunction, admit, ...)                                                           \
+    GLOG_LIMITED(logFunction, gbase::GLogger::Severity::Info, gbase::GLogger::LogLevel::Normal, admit,       \
+                 __VA_ARGS__)
+#define GLOG_WARNING_LIMITED(logFunction, admit, ...)                                                        \
+    GLOG_LIMITED(logFunction, gbase::GLogger::Severity::Warning, gbase::GLogger::LogLevel::Normal, admit,    \
+                 __VA_ARGS__)
+#define GLOG_DETAILS_LIMITED(logFunction, admit, ...)                                                        \
+    GLOG_LIMITED(logFunction, gbase::GLogger::Severity::Info, gbase::GLogger::LogLevel::Details, admit,      \
+                 __VA_ARGS__)
+
+#if GBASE_LOG_COMPILED_LEVEL >= 1
+#define GLOG_INFO(...)                                                                                       \
+    GLOG_MESSAGE(gbase::GLogger::Severity::Info, gbase::GLogger::LogLevel::Normal, __VA_ARGS__)
 #define GLOG_WARNING(...)                                                                                    \
-    {                                                                                                        \
-        std::ostringstream oss;                                                                              \
-        oss << __FILE__ << " | " << __func__ << " | ";                                                       \
-        oss << gbase::concatToString(__VA_ARGS__);                                                           \
-        gbase::GLogger::getInstance().warning(oss.str(), gbase::GLogger::LogLevel::Normal);                  \
-    }
+    GLOG_MESSAGE(gbase::GLogger::Severity::Warning, gbase::GLogger::LogLevel::Normal, __VA_ARGS__)
+#define GLOG_INFO_FMT(...)                                                                                   \
+    GLOG_FORMAT(gbase::GLogger::Severity::Info, gbase::GLogger::LogLevel::Normal, __VA_ARGS__)
+#define GLOG_WARNING_FMT(...)                                                                                \
+    GLOG_FORMAT(gbase::GLogger::Severity::Warning, gbase::GLogger::LogLevel::Normal, __VA_ARGS__)
+#define GLOG_INFO_EVERY_N(n, ...) GLOG_INFO_LIMITED(logConcat, everyN(n), __VA_ARGS__)
+#define GLOG_INFO_EVERY_MS(interval, ...)                                                                    \
+    GLOG_INFO_LIMITED(logConcat, every(std::chrono::milliseconds{interval}), __VA_ARGS__)
+#define GLOG_INFO_FIRST_N(n, ...) GLOG_INFO_LIMITED(logConcat, firstN(n), __VA_ARGS__)
+#define GLOG_INFO_FMT_EVERY_N(n, ...) GLOG_INFO_LIMITED(logFormat, everyN(n), __VA_ARGS__)
+#define GLOG_INFO_FMT_EVERY_MS(interval, ...)                                                                \
+    GLOG_INFO_LIMITED(logFormat, every(std::chrono::milliseconds{interval}), __VA_ARGS__)
+#define GLOG_INFO_FMT_FIRST_N(n, ...) GLOG_INFO_LIMITED(logFormat, firstN(n), __VA_ARGS__)
+#define GLOG_WARNING_EVERY_N(n, ...) GLOG_WARNING_LIMITED(logConcat, everyN(n), __VA_ARGS__)
+#define GLOG_WARNING_EVERY_MS(interval, ...)                                                                 \
+    GLOG_WARNING_LIMITED(logConcat, every(std::chrono::milliseconds{interval}), __VA_ARGS__)
+#define GLOG_WARNING_FIRST_N(n, ...) GLOG_WARNING_LIMITED(logConcat, firstN(n), __VA_ARGS__)
+#define GLOG_WARNING_FMT_EVERY_N(n, ...) GLOG_WARNING_LIMITED(logFormat, everyN(n), __VA_ARGS__)
+#define GLOG_WARNING_FMT_EVERY_MS(interval, ...)                                                             \
+    GLOG_WARNING_LIMITED(logFormat, every(std::chrono::milliseconds{interval}), __VA_ARGS__)
+#define GLOG_WARNING_FMT_FIRST_N(n, ...) GLOG_WARNING_LIMITED(logFormat, firstN(n), __VA_ARGS__)
+#else
+#define GLOG_INFO(...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_WARNING(...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_INFO_FMT(...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_WARNING_FMT(...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_INFO_EVERY_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_INFO_EVERY_MS(interval, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_INFO_FIRST_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_INFO_FMT_EVERY_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_INFO_FMT_EVERY_MS(interval, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_INFO_FMT_FIRST_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_WARNING_EVERY_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_WARNING_EVERY_MS(interval, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_WARNING_FIRST_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_WARNING_FMT_EVERY_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_WARNING_FMT_EVERY_MS(interval, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_WARNING_FMT_FIRST_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if GBASE_LOG_COMPILED_LEVEL >= 2
+#define GLOG_DETAILS(...)                                                                                    \
+    GLOG_MESSAGE(gbase::GLogger::Severity::Info, gbase::GLogger::LogLevel::Details, __VA_ARGS__)
+#define GLOG_DETAILS_FMT(...)                                                                                \
+    GLOG_FORMAT(gbase::GLogger::Severity::Info, gbase::GLogger::LogLevel::Details, __VA_ARGS__)
+#define GLOG_DETAILS_EVERY_N(n, ...) GLOG_DETAILS_LIMITED(logConcat, everyN(n), __VA_ARGS__)
+#define GLOG_DETAILS_EVERY_MS(interval, ...)                                                                 \
+    GLOG_DETAILS_LIMITED(logConcat, every(std::chrono::milliseconds{interval}), __VA_ARGS__)
+#define GLOG_DETAILS_FIRST_N(n, ...) GLOG_DETAILS_LIMITED(logConcat, firstN(n), __VA_ARGS__)
+#define GLOG_DETAILS_FMT_EVERY_N(n, ...) GLOG_DETAILS_LIMITED(logFormat, everyN(n), __VA_ARGS__)
+#define GLOG_DETAILS_FMT_EVERY_MS(interval, ...)                                                             \
+    GLOG_DETAILS_LIMITED(logFormat, every(std::chrono::milliseconds{interval}), __VA_ARGS__)
+#define GLOG_DETAILS_FMT_FIRST_N(n, ...) GLOG_DETAILS_LIMITED(logFormat, firstN(n), __VA_ARGS__)
+#else
+#define GLOG_DETAILS(...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_DETAILS_FMT(...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_DETAILS_EVERY_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_DETAILS_EVERY_MS(interval, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_DETAILS_FIRST_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_DETAILS_FMT_EVERY_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_DETAILS_FMT_EVERY_MS(interval, ...) GLOG_DISABLED(__VA_ARGS__)
+#define GLOG_DETAILS_FMT_FIRST_N(n, ...) GLOG_DISABLED(__VA_ARGS__)
+#endif
@@ -0,0 +1,296 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "g_basic_types.hpp"
+#include "g_inplace_function.hpp"
+
+namespace gbase {
+
+class GMailbox;
+
+/**
+ * @brief A number of worker threads which run the tasks posted to the mailboxes attached to the pool. The
+ * tasks of one mailbox never run on two workers at the same time and run in the order they were posted.
+ *
+ * The pool must outlive its mailboxes.
+ */
+class GMailboxPool {
+  public:
+    explicit GMailboxPool(Size threads = std::max(1U, std::thread::hardware_concurrency())) {
+        workers_.reserve(threads);
+        for (Size i = 0; i < threads; ++i) {
+            workers_.emplace_back([this] { run(); });
+        }
+    }
+
+    GMailboxPool(const GMailboxPool &) = delete;
+    GMailboxPool &operator=(const GMailboxPool &) = delete;
+
+    /**
+     * @brief Stops the workers. Tasks which have not started are not run.
+     */
+    ~GMailboxPool() {
+        {
+            std::lock_guard lock{mutex_};
+            stopping_ = true;
+        }
+        ready_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    Size threadCount() const { return workers_.size(); }
+
+  private:
+    friend class GMailbox;
+
+    inline void schedule(GMailbox *mailbox);
+    inline void unschedule(GMailbox *mailbox);
+    inline void run();
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<GMailbox *> queue_;
+    bool stopping_{false};
+    std::vector<std::thread> workers_;
+};
+
+/**
+ * @brief The number of bytes a mailbox task stores inline, e.g. a shared callback, a subject and a small
+ * parameter.
+ */
+constexpr Size MailboxTaskCapacity = 6 * sizeof(void *);
+
+/**
+ * @brief A queue of tasks for one receiver, e.g. the notifications of queued connections, see
+ * GSignal::connectQueued().
+ *
+ * The tasks run either when the owner of the mailbox calls drain(), e.g. from its event loop, or on a
+ * GMailboxPool which the mailbox is attached to. A task posted with a coalescing key replaces a pending task
+ * with the same key, so a slow receiver only sees the latest of a burst of notifications.
+ *
+ * A receiver should first disconnect its queued connections, so no more tasks are posted, and then close()
+ * its mailbox before its other members are destroyed, since close() waits until no task of the mailbox is
+ * running.
+ */
+class GMailbox {
+  public:
+    using Task = GInplaceFunction<void(), MailboxTaskCapacity>;
+
+    /**
+     * @brief Identifies tasks which may replace each other, e.g. a connection and a subject.
+     */
+    struct Key {
+        const void *source{nullptr};
+        const void *subject{nullptr};
+
+        bool operator==(const Key &) const = default;
+    };
+
+    /**
+     * @brief Creates a mailbox which is drained by calling drain().
+     */
+    GMailbox() = default;
+
+    /**
+     * @brief Creates a mailbox which is drained by the workers of the pool.
+     */
+    explicit GMailbox(GMailboxPool &pool) : pool_{&pool} {}
+
+    GMailbox(const GMailbox &) = delete;
+    GMailbox &operator=(const GMailbox &) = delete;
+
+    ~GMailbox() { close(); }
+
+    /**
+     * @brief Queues a task. Thread-safe. The task is discarded if the mailbox is closed.
+     *
+     * @param coalesceKey Replaces a pending task with the same key instead of queueing another task.
+     */
+    void post(Task task, std::optional<Key> coalesceKey = std::nullopt) {
+        bool schedule{false};
+        {
+            std::lock_guard lock{mutex_};
+            if (closed_) {
+                return;
+            }
+
+            if (coalesceKey) {
+                const auto [it, inserted] = pendingKeys_.try_emplace(*coalesceKey, tasks_.size());
+                if (!inserted) {
+                    tasks_[it->second] = std::move(task);
+                    return;
+                }
+            }
+            tasks_.push_back(std::move(task));
+
+            if (pool_ != nullptr && !scheduled_) {
+                scheduled_ = true;
+                schedule = true;
+            }
+        }
+
+        if (schedule) {
+            pool_->schedule(this);
+        } else if (pool_ == nullptr) {
+            posted_.notify_one();
+        }
+    }
+
+    /**
+     * @brief Runs the pending tasks on the calling thread and returns the number of tasks run. Must not be
+     * called for a mailbox attached to a pool.
+     */
+    Size drain() {
+        std::lock_guard drainLock{drainMutex_};
+        return runPending();
+    }
+
+    /**
+     * @brief Waits until a task is posted or the timeout has passed, and then drains the mailbox.
+     */
+    Size waitAndDrain(std::chrono::milliseconds timeout) {
+        {
+            std::unique_lock lock{mutex_};
+            posted_.wait_for(lock, timeout, [this] { return !tasks_.empty() || closed_; });
+        }
+        return drain();
+    }
+
+    Size pendingCount() const {
+        std::lock_guard lock{mutex_};
+        return tasks_.size();
+    }
+
+    /**
+     * @brief Discards the pending tasks, stops accepting new tasks and waits until no task of the mailbox is
+     * running. Must not be called from a task of the mailbox.
+     */
+    void close() {
+        {
+            std::lock_guard lock{mutex_};
+            if (closed_) {
+                return;
+            }
+            closed_ = true;
+            tasks_.clear();
+            pendingKeys_.clear();
+        }
+        posted_.notify_all();
+
+        if (pool_ != nullptr) {
+            pool_->unschedule(this);
+        }
+        std::lock_guard drainLock{drainMutex_};
+    }
+
+  private:
+    friend class GMailboxPool;
+
+    struct KeyHash {
+        Size operator()(const Key &key) const {
+            const Size source = std::hash<const void *>{}(key.source);
+            return source ^ (std::hash<const void *>{}(key.subject) + 0x9e3779b97f4a7c15ULL + (source << 6));
+        }
+    };
+
+    /**
+     * @brief Runs the pending tasks. The caller must hold drainMutex_.
+     */
+    Size runPending() {
+        {
+            std::lock_guard lock{mutex_};
+            running_.swap(tasks_);
+            pendingKeys_.clear();
+        }
+
+        for (auto &task : running_) {
+            task();
+        }
+        const Size count = running_.size();
+        running_.clear();
+        return count;
+    }
+
+    /**
+     * @brief Drains the mailbox on a worker of the pool, and tells if it has to be scheduled again for tasks
+     * posted meanwhile. The caller must hold drainMutex_.
+     */
+    bool drainScheduled() {
+        runPending();
+
+        std::lock_guard lock{mutex_};
+        scheduled_ = !tasks_.empty() && !closed_;
+        return scheduled_;
+    }
+
+    mutable std::mutex mutex_;
+    std::condition_variable posted_;
+    std::vector<Task> tasks_;
+    std::unordered_map<Key, Size, KeyHash> pendingKeys_;
+    bool closed_{false};
+    bool scheduled_{false};
+
+    std::mutex drainMutex_;
+    std::vector<Task> running_;
+
+    GMailboxPool *pool_{nullptr};
+};
+
+void GMailboxPool::schedule(GMailbox *mailbox) {
+    {
+        std::lock_guard lock{mutex_};
+        queue_.push_back(mailbox);
+    }
+    ready_.notify_one();
+}
+
+void GMailboxPool::unschedule(GMailbox *mailbox) {
+    std::lock_guard lock{mutex_};
+    std::erase(queue_, mailbox);
+}
+
+void GMailboxPool::run() {
+    for (;;) {
+        GMailbox *mailbox{nullptr};
+        {
+            std::unique_lock lock{mutex_};
+            ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (stopping_) {
+                return;
+            }
+            mailbox = queue_.front();
+            queue_.pop_front();
+            // Locked before the pool lock is released, so a closing mailbox waits for this worker.
+            mailbox->drainMutex_.lock();
+        }
+
+        bool rescheduled{false};
+        if (mailbox->drainScheduled()) {
+            std::lock_guard lock{mutex_};
+            // close() sets closed_ before it unschedules, so a closed mailbox is not queued again.
+            std::lock_guard mailboxLock{mailbox->mutex_};
+            if (!mailbox->closed_) {
+                queue_.push_back(mailbox);
+                rescheduled = true;
+            }
+        }
+        mailbox->drainMutex_.unlock();
+        if (rescheduled) {
+            ready_.notify_one();
+        }
+    }
+}
+
+} // namespace gbase
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+
+#include "g_basic_types.hpp"
+#include "g_exceptions.hpp"
+#include "g_files.hpp"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gbase {
+
+/**
+ * @brief A file of fixed size mapped read-write into memory. Writes to data() end up in the file without any
+ * system calls; sync() tells the operating system to write the changed pages to disk.
+ *
+ * Example usage:
+ * @code
+ * GMappedFile file{"data.bin", 4096};
+ * std::memcpy(file.data(), "abc", 3);
+ * file.close(3); // Truncates the file to the 3 used bytes.
+ * @endcode
+ */
+class GMappedFile {
+  public:
+    GMappedFile() = default;
+
+    /**
+     * @brief Creates the file, or truncates an existing file, with the given size and maps it.
+     */
+    GMappedFile(const GPath &path, Size size) : size_{size} {
+        if (size == 0) {
+            GTHROW(GInvalidArgument, "Mapped file size must be positive: ", path);
+        }
+        open(path);
+    }
+
+    GMappedFile(const GMappedFile &) = delete;
+    GMappedFile &operator=(const GMappedFile &) = delete;
+
+    GMappedFile(GMappedFile &&other) noexcept { swap(other); }
+
+    GMappedFile &operator=(GMappedFile &&other) noexcept {
+        GMappedFile moved{std::move(other)};
+        swap(moved);
+        return *this;
+    }
+
+    /**
+     * @brief Unmaps the file. The file keeps its full size, see close().
+     */
+    ~GMappedFile() { unmap(); }
+
+    bool isOpen() const { return data_ != nullptr; }
+
+    Char *data() { return data_; }
+    const Char *data() const { return data_; }
+
+    Size size() const { return size_; }
+
+    /**
+     * @brief Gives the granularity of sync(), i.e. the page size of the operating system.
+     */
+    static Size pageSize() {
+#if defined(_WIN32)
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return static_cast<Size>(info.dwPageSize);
+#else
+        static const Size size = static_cast<Size>(sysconf(_SC_PAGESIZE));
+        return size;
+#endif
+    }
+
+    /**
+     * @brief Starts writing the pages overlapping [offset, offset + length) to disk.
+     *
+     * @param wait Waits until the pages are written when true.
+     */
+    void sync(Size offset, Size length, bool wait = false) {
+        if (!isOpen() || length == 0 || offset >= size_) {
+            return;
+        }
+        const Size begin = offset - offset % pageSize();
+        const Size end = std::min(offset + length, size_);
+#if defined(_WIN32)
+        FlushViewOfFile(data_ + begin, end - begin);
+        if (wait) {
+            FlushFileBuffers(file_);
+        }
+#else
+        msync(data_ + begin, end - begin, wait ? MS_SYNC : MS_ASYNC);
+#endif
+    }
+
+    /**
+     * @brief Unmaps the file and truncates it to the given number of used bytes.
+     */
+    void close(Size usedSize) {
+        if (!isOpen()) {
+            return;
+        }
+        usedSize = std::min(usedSize, size_);
+#if defined(_WIN32)
+        UnmapViewOfFile(data_);
+        CloseHandle(mapping_);
+        LARGE_INTEGER position;
+        position.QuadPart = static_cast<LONGLONG>(usedSize);
+        SetFilePointerEx(file_, position, nullptr, FILE_BEGIN);
+        SetEndOfFile(file_);
+        CloseHandle(file_);
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+#else
+        munmap(data_, size_);
+        [[maybe_unused]] const int result = ftruncate(file_, static_cast<off_t>(usedSize));
+        ::close(file_);
+        file_ = -1;
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+  private:
+    void open(const GPath &path) {
+#if defined(_WIN32)
+        file_ = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                            CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            GTHROW(GRuntimeError, "Could not create mapped file: ", path);
+        }
+        const auto size = static_cast<unsigned long long>(size_);
+        mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32),
+                                      static_cast<DWORD>(size & 0xFFFFFFFFu), nullptr);
+        if (mapping_ == nullptr) {
+            CloseHandle(file_);
+            GTHROW(GRuntimeError, "Could not map file: ", path);
+        }
+        data_ = static_cast<Char *>(MapViewOfFile(mapping_, FILE_MAP_WRITE, 0, 0, size_));
+        if (data_ == nullptr) {
+            CloseHandle(mapping_);
+            CloseHandle(file_);
+            GTHROW(GRuntimeError, "Could not map file: ", path);
+        }
+#else
+        file_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (file_ < 0) {
+            GTHROW(GRuntimeError, "Could not create mapped file: ", path, ": ", std::strerror(errno));
+        }
+        if (ftruncate(file_, static_cast<off_t>(size_)) != 0) {
+            const int error = errno;
+            ::close(file_);
+            GTHROW(GRuntimeError, "Could not resize mapped file: ", path, ": ", std::strerror(error));
+        }
+        void *data = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, file_, 0);
+        if (data == MAP_FAILED) {
+            const int error = errno;
+            ::close(file_);
+            GTHROW(GRuntimeError, "Could not map file: ", path, ": ", std::strerror(error));
+        }
+        data_ = static_cast<Char *>(data);
+#endif
+    }
+
+    void unmap() {
+        if (!isOpen()) {
+            return;
+        }
+#if defined(_WIN32)
+        UnmapViewOfFile(data_);
+        CloseHandle(mapping_);
+        CloseHandle(file_);
+#else
+        munmap(data_, size_);
+        ::close(file_);
+#endif
+        data_ = nullptr;
+    }
+
+    void swap(GMappedFile &other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(file_, other.file_);
+#if defined(_WIN32)
+        std::swap(mapping_, other.mapping_);
+#endif
+    }
+
+    Char *data_{nullptr};
+    Size size_{0};
+#if defined(_WIN32)
+    HANDLE file_{INVALID_HANDLE_VALUE};
+    HANDLE mapping_{nullptr};
+#else
+    int file_{-1};
+#endif
+};
+
+} // namespace gbase
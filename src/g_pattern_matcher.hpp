@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <queue>
+#include <string_view>
+#include <vector>
+
+#include "g_basic_types.hpp"
+
+namespace gbase {
+
+/**
+ * @brief Searches a text for many patterns at once (Aho-Corasick).
+ *
+ * The patterns are compiled once into a deterministic automaton, so a search makes one table lookup per
+ * character of the text regardless of the number of patterns.
+ *
+ * Example usage:
+ * @code
+ * const GPatternMatcher matcher{std::vector<String>{"he", "she", "hers"}};
+ * matcher.matchesAny("ushers"); // true
+ * @endcode
+ */
+class GPatternMatcher {
+  public:
+    GPatternMatcher() = default;
+
+    template <RangeOf<String> Range> explicit GPatternMatcher(const Range &patterns) {
+        for (const auto &pattern : patterns) {
+            patterns_.emplace_back(pattern);
+        }
+        compile();
+    }
+
+    GPatternMatcher(std::initializer_list<String> patterns) : patterns_{patterns} { compile(); }
+
+    ~GPatternMatcher() = default;
+
+    /**
+     * @brief Tells if the matcher has no patterns.
+     */
+    bool empty() const { return patterns_.empty(); }
+
+    /**
+     * @brief Returns the patterns the matcher was compiled from.
+     */
+    const std::vector<String> &patterns() const { return patterns_; }
+
+    /**
+     * @brief Tells if any of the patterns occurs in the text.
+     */
+    bool matchesAny(std::string_view text) const { return matchesAny({text}); }
+
+    /**
+     * @brief Tells if any of the patterns occurs in the concatenation of the texts, without concatenating
+     * them.
+     */
+    bool matchesAny(std::initializer_list<std::string_view> texts) const {
+        if (patterns_.empty()) {
+            return false;
+        }
+        if (terminal_[0]) {
+            return true;
+        }
+
+        Integer state = 0;
+        for (const auto text : texts) {
+            for (const Char c : text) {
+                state = transitions_[state * classCount_ + byteClass_[static_cast<Byte>(c)]];
+                if (terminal_[state]) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+  private:
+    void compile() {
+        // Only the bytes which occur in the patterns need their own column in the transition table, all
+        // other bytes share class 0.
+        byteClass_.fill(0);
+        classCount_ = 1;
+        for (const auto &pattern : patterns_) {
+            for (const Char c : pattern) {
+                auto &byteClass = byteClass_[static_cast<Byte>(c)];
+                if (byteClass == 0) {
+                    byteClass = static_cast<std::uint16_t>(classCount_++);
+                }
+            }
+        }
+
+        // Build the trie, -1 marks a missing edge.
+        transitions_.assign(classCount_, -1);
+        terminal_.assign(1, false);
+
+        for (const auto &pattern : patterns_) {
+            Integer state = 0;
+            for (const Char c : pattern) {
+                const Size index = state * classCount_ + byteClass_[static_cast<Byte>(c)];
+                if (transitions_[index] < 0) {
+                    transitions_[index] = static_cast<Integer>(terminal_.size());
+                    transitions_.resize(transitions_.size() + classCount_, -1);
+                    terminal_.push_back(false);
+                }
+                state = transitions_[index];
+            }
+            terminal_[state] = true;
+        }
+
+        // Breadth first through the trie, replacing missing edges with the edges of the failure state so
+        // the table becomes a complete automaton.
+        std::vector<Integer> failure(terminal_.size(), 0);
+        std::queue<Integer> queue;
+
+        for (Size byteClass = 0; byteClass < classCount_; ++byteClass) {
+            Integer &next = transitions_[byteClass];
+            if (next < 0) {
+                next = 0;
+            } else {
+                queue.push(next);
+            }
+        }
+
+        while (!queue.empty()) {
+            const Integer state = queue.front();
+            queue.pop();
+            terminal_[state] = terminal_[state] || terminal_[failure[state]];
+
+            for (Size byteClass = 0; byteClass < classCount_; ++byteClass) {
+                Integer &next = transitions_[state * classCount_ + byteClass];
+                const Integer fallback = transitions_[failure[state] * classCount_ + byteClass];
+                if (next < 0) {
+                    next = fallback;
+                } else {
+                    failure[next] = fallback;
+                    queue.push(next);
+                }
+            }
+        }
+    }
+
+    std::vector<String> patterns_;
+    std::array<std::uint16_t, 256> byteClass_{};
+    Size classCount_{1};
+    std::vector<Integer> transitions_;
+    std::vector<bool> terminal_;
+};
+
+} // namespace gbase
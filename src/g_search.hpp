@@ -0,0 +1,281 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "g_basic_types.hpp"
+
+/**
+ * @def GBASE_SIMD_SEARCH
+ * @brief 2 if the searches of g_search.hpp compare 32 bytes at once with AVX2, 1 if they compare 16 bytes at
+ * once with SSE2 and 0 if they compare one value at a time. Defaults to the best instruction set enabled by
+ * the compiler flags, e.g. -mavx2 or -march=native.
+ */
+#ifndef GBASE_SIMD_SEARCH
+#if defined(__AVX2__)
+#define GBASE_SIMD_SEARCH 2
+#elif defined(__SSE2__)
+#define GBASE_SIMD_SEARCH 1
+#else
+#define GBASE_SIMD_SEARCH 0
+#endif
+#endif
+
+#if GBASE_SIMD_SEARCH > 0
+#include <immintrin.h>
+#endif
+
+namespace gbase {
+
+/**
+ * @brief Types which the searches compare a register of values at a time: integers and IEEE 754 float and
+ * double. Other types are compared one value at a time with operator==.
+ */
+template <typename Type>
+concept SimdSearchable = (std::integral<Type> && !std::same_as<Type, bool>) ||
+                         (std::floating_point<Type> && std::numeric_limits<Type>::is_iec559 &&
+                          (sizeof(Type) == 4 || sizeof(Type) == 8));
+
+/**
+ * @brief findFirstOf() compares up to this number of candidates a register at a time, and looks up the
+ * values in a sorted copy of the candidates for more candidates.
+ */
+constexpr Size FindFirstOfSimdCandidates = 8;
+
+#if GBASE_SIMD_SEARCH > 0
+
+#if GBASE_SIMD_SEARCH >= 2
+using SimdRegister = __m256i;
+#else
+using SimdRegister = __m128i;
+#endif
+
+/**
+ * @brief The number of values of the type which are compared at once.
+ */
+template <typename Type> constexpr Size SimdLanes = sizeof(SimdRegister) / sizeof(Type);
+
+/**
+ * @brief The bits of a comparison mask which belong to one value.
+ */
+template <typename Type> constexpr std::uint32_t SimdLaneBits = (std::uint32_t{1} << sizeof(Type)) - 1;
+
+/**
+ * @brief Gives a register with all values set to the value.
+ */
+template <SimdSearchable Type> SimdRegister simdBroadcast(Type value) {
+#if GBASE_SIMD_SEARCH >= 2
+    if constexpr (sizeof(Type) == 1) {
+        return _mm256_set1_epi8(std::bit_cast<std::int8_t>(value));
+    } else if constexpr (sizeof(Type) == 2) {
+        return _mm256_set1_epi16(std::bit_cast<std::int16_t>(value));
+    } else if constexpr (sizeof(Type) == 4) {
+        return _mm256_set1_epi32(std::bit_cast<std::int32_t>(value));
+    } else {
+        return _mm256_set1_epi64x(std::bit_cast<std::int64_t>(value));
+    }
+#else
+    if constexpr (sizeof(Type) == 1) {
+        return _mm_set1_epi8(std::bit_cast<std::int8_t>(value));
+    } else if constexpr (sizeof(Type) == 2) {
+        return _mm_set1_epi16(std::bit_cast<std::int16_t>(value));
+    } else if constexpr (sizeof(Type) == 4) {
+        return _mm_set1_epi32(std::bit_cast<std::int32_t>(value));
+    } else {
+        return _mm_set1_epi64x(std::bit_cast<std::int64_t>(value));
+    }
+#endif
+}
+
+/**
+ * @brief Compares SimdLanes values from the address with the broadcast needle, and gives a mask with the
+ * SimdLaneBits of each equal value set. Floating point values compare like operator==, i.e. NaN never
+ * matches and negative zero matches positive zero.
+ */
+template <SimdSearchable Type> std::uint32_t simdEqualMask(const Type *values, SimdRegister needle) {
+#if GBASE_SIMD_SEARCH >= 2
+    if constexpr (std::same_as<Type, float>) {
+        const __m256 equal = _mm256_cmp_ps(_mm256_loadu_ps(values), _mm256_castsi256_ps(needle), _CMP_EQ_OQ);
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_castps_si256(equal)));
+    } else if constexpr (std::floating_point<Type>) {
+        const __m256d equal = _mm256_cmp_pd(_mm256_loadu_pd(values), _mm256_castsi256_pd(needle), _CMP_EQ_OQ);
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_castpd_si256(equal)));
+    } else {
+        const __m256i loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values));
+        __m256i equal;
+        if constexpr (sizeof(Type) == 1) {
+            equal = _mm256_cmpeq_epi8(loaded, needle);
+        } else if constexpr (sizeof(Type) == 2) {
+            equal = _mm256_cmpeq_epi16(loaded, needle);
+        } else if constexpr (sizeof(Type) == 4) {
+            equal = _mm256_cmpeq_epi32(loaded, needle);
+        } else {
+            equal = _mm256_cmpeq_epi64(loaded, needle);
+        }
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+    }
+#else
+    if constexpr (std::same_as<Type, float>) {
+        const __m128 equal = _mm_cmpeq_ps(_mm_loadu_ps(values), _mm_castsi128_ps(needle));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_castps_si128(equal)));
+    } else if constexpr (std::floating_point<Type>) {
+        const __m128d equal = _mm_cmpeq_pd(_mm_loadu_pd(values), _mm_castsi128_pd(needle));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_castpd_si128(equal)));
+    } else {
+        const __m128i loaded = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values));
+        __m128i equal;
+        if constexpr (sizeof(Type) == 1) {
+            equal = _mm_cmpeq_epi8(loaded, needle);
+        } else if constexpr (sizeof(Type) == 2) {
+            equal = _mm_cmpeq_epi16(loaded, needle);
+        } else if constexpr (sizeof(Type) == 4) {
+            equal = _mm_cmpeq_epi32(loaded, needle);
+        } else {
+            // SSE2 has no 64 bit comparison: both 32 bit halves have to be equal.
+            const __m128i halves = _mm_cmpeq_epi32(loaded, needle);
+            equal = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(equal));
+    }
+#endif
+}
+
+#endif
+
+/**
+ * @brief Gives the index of the iterator into the values, or std::nullopt for the end of the values.
+ */
+template <typename Type>
+std::optional<Size> indexOf(std::span<const Type> values, typename std::span<const Type>::iterator it) {
+    return it != values.end() ? std::optional<Size>{static_cast<Size>(it - values.begin())} : std::nullopt;
+}
+
+/**
+ * @brief Searches for the value.
+ * @return The index of the first value equal to the value, or std::nullopt if there is none.
+ */
+template <typename Type> std::optional<Size> findValue(std::span<const Type> values, const Type &value) {
+    Size index = 0;
+#if GBASE_SIMD_SEARCH > 0
+    if constexpr (SimdSearchable<Type>) {
+        const SimdRegister needle = simdBroadcast(value);
+        for (; index + SimdLanes<Type> <= values.size(); index += SimdLanes<Type>) {
+            if (const std::uint32_t mask = simdEqualMask(values.data() + index, needle); mask != 0) {
+                return index + std::countr_zero(mask) / sizeof(Type);
+            }
+        }
+    }
+#endif
+    for (; index < values.size(); ++index) {
+        if (values[index] == value) {
+            return index;
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Calls function(index) with the index of each value equal to the value, in ascending order.
+ */
+template <typename Type, typename Function>
+void forEachIndexOf(std::span<const Type> values, const Type &value, Function function) {
+    Size index = 0;
+#if GBASE_SIMD_SEARCH > 0
+    if constexpr (SimdSearchable<Type>) {
+        const SimdRegister needle = simdBroadcast(value);
+        for (; index + SimdLanes<Type> <= values.size(); index += SimdLanes<Type>) {
+            for (std::uint32_t mask = simdEqualMask(values.data() + index, needle); mask != 0;) {
+                const Size lane = std::countr_zero(mask) / sizeof(Type);
+                function(index + lane);
+                mask &= ~(SimdLaneBits<Type> << (lane * sizeof(Type)));
+            }
+        }
+    }
+#endif
+    for (; index < values.size(); ++index) {
+        if (values[index] == value) {
+            function(index);
+        }
+    }
+}
+
+/**
+ * @brief Counts the values equal to the value.
+ */
+template <typename Type> Size countValue(std::span<const Type> values, const Type &value) {
+    Size count = 0;
+    Size index = 0;
+#if GBASE_SIMD_SEARCH > 0
+    if constexpr (SimdSearchable<Type>) {
+        const SimdRegister needle = simdBroadcast(value);
+        for (; index + SimdLanes<Type> <= values.size(); index += SimdLanes<Type>) {
+            count += std::popcount(simdEqualMask(values.data() + index, needle)) / sizeof(Type);
+        }
+    }
+#endif
+    for (; index < values.size(); ++index) {
+        count += values[index] == value ? 1 : 0;
+    }
+    return count;
+}
+
+/**
+ * @brief Searches for any of the candidates.
+ * @return The index of the first value equal to one of the candidates, or std::nullopt if there is none.
+ */
+template <typename Type>
+std::optional<Size> findFirstOf(std::span<const Type> values, std::span<const Type> candidates) {
+    if (candidates.empty()) {
+        return std::nullopt;
+    }
+    if (candidates.size() == 1) {
+        return findValue(values, candidates.front());
+    }
+
+    if constexpr (SimdSearchable<Type>) {
+        if (candidates.size() > FindFirstOfSimdCandidates) {
+            // NaN equals nothing, and would break the order of the sorted candidates.
+            std::vector<Type> sorted;
+            sorted.reserve(candidates.size());
+            std::ranges::copy_if(candidates, std::back_inserter(sorted), [](Type c) { return c == c; });
+            std::ranges::sort(sorted);
+            // A binary search finds NaN equivalent to any value, so the match is confirmed with operator==.
+            const auto it = std::ranges::find_if(values, [&sorted](Type value) {
+                const auto candidate = std::ranges::lower_bound(sorted, value);
+                return candidate != sorted.end() && *candidate == value;
+            });
+            return indexOf(values, it);
+        }
+
+        Size index = 0;
+#if GBASE_SIMD_SEARCH > 0
+        SimdRegister needles[FindFirstOfSimdCandidates];
+        for (Size c = 0; c < candidates.size(); ++c) {
+            needles[c] = simdBroadcast(candidates[c]);
+        }
+        for (; index + SimdLanes<Type> <= values.size(); index += SimdLanes<Type>) {
+            std::uint32_t mask = 0;
+            for (Size c = 0; c < candidates.size(); ++c) {
+                mask |= simdEqualMask(values.data() + index, needles[c]);
+            }
+            if (mask != 0) {
+                return index + std::countr_zero(mask) / sizeof(Type);
+            }
+        }
+#endif
+        const auto rest = values.subspan(index);
+        const auto found = indexOf(rest, std::ranges::find_first_of(rest, candidates));
+        return found ? std::optional<Size>{index + *found} : std::nullopt;
+    } else {
+        return indexOf(values, std::ranges::find_first_of(values, candidates));
+    }
+}
+
+} // namespace gbase
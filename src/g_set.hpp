@@ -2,36 +2,59 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
 #include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <ostream>
 #include <ranges>
 #include <set>
+#include <utility>
 
 #include "g_basic_types.hpp"
+#include "g_set_algebra.hpp"
 
 namespace gbase {
 
 /**
  * @brief A customized std::set.
+ *
+ * The allocator is passed on to std::set, which allocates one node per element. Copies made by the
+ * operators use the allocator of the given set.
  */
-template <typename Type> class GSet : private std::set<Type> {
+template <typename Type, typename Allocator = std::allocator<Type>>
+class GSet : private std::set<Type, std::less<Type>, Allocator> {
   private:
-    using base = std::set<Type>;
+    using base = std::set<Type, std::less<Type>, Allocator>;
 
     constexpr static bool defaultCompare(const Type &a, const Type &b) { return a < b; };
 
   public:
     using base::set; // Using default set constructors.
 
-    GSet(std::initializer_list<Type> initList) : base(initList) {}
+    GSet(std::initializer_list<Type> initList, const Allocator &allocator = Allocator())
+        : base(initList, allocator) {}
 
-    template <InputIteratorOf<Type> InputIt> GSet(InputIt first, InputIt last) : base(first, last){};
+    template <InputIteratorOf<Type> InputIt>
+    GSet(InputIt first, InputIt last, const Allocator &allocator = Allocator())
+        : base(first, last, allocator){};
 
     template <RangeOf<Type> Range>
-    explicit GSet(const Range &range) : base(std::ranges::begin(range), std::ranges::end(range)){};
+    explicit GSet(const Range &range, const Allocator &allocator = Allocator())
+        : base(std::ranges::begin(range), std::ranges::end(range), allocator){};
 
     template <RangeOf<Type> Range>
-    explicit GSet(Range &&range) : base(std::ranges::begin(range), std::ranges::end(range)){};
+    explicit GSet(Range &&range, const Allocator &allocator = Allocator())
+        : base(std::ranges::begin(range), std::ranges::end(range), allocator){};
+
+    GSet(const GSet &other) = default;
+    GSet(GSet &&other) noexcept = default;
+    GSet(const GSet &other, const Allocator &allocator) : base(other, allocator) {}
+    GSet(GSet &&other, const Allocator &allocator) : base(std::move(other), allocator) {}
+
+    GSet &operator=(const GSet &other) = default;
+    GSet &operator=(GSet &&other) = default;
 
     ~GSet() = default;
 
@@ -140,6 +163,35 @@ template <typename Type> class GSet : private std::set<Type> {
         }
     }
 
+    /**
+     * @brief Removes the values of the given set. A few values are erased one by one, and otherwise both
+     * sets are merged in one pass which erases the common values in place.
+     */
+    constexpr void erase(const GSet &values) {
+        if (&values == this) {
+            clear();
+            return;
+        }
+        if (values.size() * static_cast<Size>(std::bit_width(this->size())) < this->size()) {
+            for (const auto &value : values) {
+                base::erase(value);
+            }
+            return;
+        }
+
+        auto it = this->begin();
+        for (auto other = values.begin(); it != this->end() && other != values.end();) {
+            if (*it < *other) {
+                ++it;
+            } else if (*other < *it) {
+                ++other;
+            } else {
+                it = base::erase(it);
+                ++other;
+            }
+        }
+    }
+
     /**
      * @brief Removes a value from the set.
      */
@@ -164,6 +216,43 @@ template <typename Type> class GSet : private std::set<Type> {
         return std::includes(set.begin(), set.end(), this->begin(), this->end());
     }
 
+    /**
+     * @brief Returns the values which are in both sets. The sets are merged in one pass, and the result is
+     * built by appending at its end. Use intersectSorted() to write the values into a buffer instead.
+     */
+    GSet intersect(const GSet &set) const {
+        GSet result(get_allocator());
+        std::ranges::set_intersection(*this, set, std::inserter(result, result.end()));
+        return result;
+    }
+
+    /**
+     * @brief Returns the values which are in either set, see intersect().
+     */
+    GSet unite(const GSet &set) const {
+        GSet result(get_allocator());
+        std::ranges::set_union(*this, set, std::inserter(result, result.end()));
+        return result;
+    }
+
+    /**
+     * @brief Returns the values of this set which are not in the given set, see intersect().
+     */
+    GSet difference(const GSet &set) const {
+        GSet result(get_allocator());
+        std::ranges::set_difference(*this, set, std::inserter(result, result.end()));
+        return result;
+    }
+
+    /**
+     * @brief Returns the values which are in exactly one of the sets, see intersect().
+     */
+    GSet symmetricDifference(const GSet &set) const {
+        GSet result(get_allocator());
+        std::ranges::set_symmetric_difference(*this, set, std::inserter(result, result.end()));
+        return result;
+    }
+
     /**
      * @brief Searches for a value in the vector.
      * @return The index of the first value found, or -1 if the value was not found.
@@ -203,44 +292,110 @@ template <typename Type> class GSet : private std::set<Type> {
 /**
  * @brief Returns a copy of set with given value inserted.
  */
-template <typename Type> constexpr GSet<Type> operator+(const GSet<Type> &set, const Type &value) {
-    GSet<Type> copy{set};
+template <typename Type, typename Allocator>
+constexpr GSet<Type, Allocator> operator+(const GSet<Type, Allocator> &set, const Type &value) {
+    GSet<Type, Allocator> copy(set, set.get_allocator());
     copy += value;
     return copy;
 }
 
+/**
+ * @brief Inserts given value into the temporary set and returns it without copying.
+ */
+template <typename Type, typename Allocator>
+constexpr GSet<Type, Allocator> operator+(GSet<Type, Allocator> &&set, const Type &value) {
+    set += value;
+    return std::move(set);
+}
+
 /**
  * @brief Returns a copy of set with given value removed.
  */
-template <typename Type> constexpr GSet<Type> operator-(const GSet<Type> &set, const Type &value) {
-    GSet<Type> copy{set};
+template <typename Type, typename Allocator>
+constexpr GSet<Type, Allocator> operator-(const GSet<Type, Allocator> &set, const Type &value) {
+    GSet<Type, Allocator> copy(set, set.get_allocator());
     copy -= value;
     return copy;
 }
 
+/**
+ * @brief Removes given value from the temporary set and returns it without copying.
+ */
+template <typename Type, typename Allocator>
+constexpr GSet<Type, Allocator> operator-(GSet<Type, Allocator> &&set, const Type &value) {
+    set -= value;
+    return std::move(set);
+}
+
 /**
  * @brief Returns a copy of set with given range of values inserted.
  */
-template <typename Type, RangeOf<Type> Range>
-constexpr GSet<Type> operator+(const GSet<Type> &set, const Range &range) {
-    GSet<Type> copy{set};
+template <typename Type, typename Allocator, RangeOf<Type> Range>
+constexpr GSet<Type, Allocator> operator+(const GSet<Type, Allocator> &set, const Range &range) {
+    GSet<Type, Allocator> copy(set, set.get_allocator());
     copy.extend(range);
     return copy;
 }
 
 /**
- * @brief Returns a copy of set with given range of values inserted.
+ * @brief Inserts given range of values into the temporary set and returns it without copying.
  */
-template <typename Type, RangeOf<Type> Range>
-constexpr GSet<Type> operator-(const GSet<Type> &set, const Range &range) {
-    GSet<Type> copy{set};
+template <typename Type, typename Allocator, RangeOf<Type> Range>
+constexpr GSet<Type, Allocator> operator+(GSet<Type, Allocator> &&set, const Range &range) {
+    set.extend(range);
+    return std::move(set);
+}
+
+/**
+ * @brief Returns a copy of set with given range of values removed.
+ */
+template <typename Type, typename Allocator, RangeOf<Type> Range>
+constexpr GSet<Type, Allocator> operator-(const GSet<Type, Allocator> &set, const Range &range) {
+    GSet<Type, Allocator> copy(set, set.get_allocator());
     copy.erase(range);
     return copy;
 }
 
-template <typename Type> constexpr std::ostream &operator<<(std::ostream &s, const GSet<Type> &v) {
+/**
+ * @brief Removes given range of values from the temporary set and returns it without copying.
+ */
+template <typename Type, typename Allocator, RangeOf<Type> Range>
+constexpr GSet<Type, Allocator> operator-(GSet<Type, Allocator> &&set, const Range &range) {
+    set.erase(range);
+    return std::move(set);
+}
+
+/**
+ * @brief Returns the values of the first set which are not in the second set, in one pass over both sets.
+ */
+template <typename Type, typename Allocator>
+GSet<Type, Allocator> operator-(const GSet<Type, Allocator> &first, const GSet<Type, Allocator> &second) {
+    return first.difference(second);
+}
+
+/**
+ * @brief Removes the values of the second set from the temporary first set and returns it without copying,
+ * see erase().
+ */
+template <typename Type, typename Allocator>
+GSet<Type, Allocator> operator-(GSet<Type, Allocator> &&first, const GSet<Type, Allocator> &second) {
+    first.erase(second);
+    return std::move(first);
+}
+
+template <typename Type, typename Allocator>
+constexpr std::ostream &operator<<(std::ostream &s, const GSet<Type, Allocator> &v) {
     v.print(s);
     return s;
 }
 
+namespace pmr {
+
+/**
+ * @brief A GSet which allocates its nodes from a std::pmr::memory_resource, e.g. an arena.
+ */
+template <typename Type> using GSet = gbase::GSet<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace gbase
\ No newline at end of file
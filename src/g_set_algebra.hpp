@@ -0,0 +1,139 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <ranges>
+#include <span>
+
+#include "g_basic_types.hpp"
+#include "g_exceptions.hpp"
+#include "g_search.hpp"
+
+namespace gbase {
+
+/**
+ * @brief Types which intersectSorted() intersects four values at a time with SSE2: 32 bit integers.
+ */
+template <typename Type>
+concept SimdIntersectable = std::integral<Type> && sizeof(Type) == 4;
+
+/**
+ * @brief Sorted ranges without duplicates, e.g. a GSet, a GFlatSet or a sorted GVector, with values of the
+ * type.
+ */
+template <typename Range, typename Type>
+concept SortedSetOf = std::ranges::sized_range<Range> && RangeOf<Range, Type>;
+
+/**
+ * @brief Raises GInvalidArgument if the output of a set operation cannot hold the largest possible result.
+ */
+inline void requireOutputCapacity(Size available, Size required) {
+    if (available < required) {
+        GTHROW(GInvalidArgument, "Output buffer holds ", available, " values, but ", required,
+               " are needed.");
+    }
+}
+
+#if GBASE_SIMD_SEARCH > 0
+
+/**
+ * @brief Intersects sorted 32 bit integers four by four. A block of the first values is compared with the
+ * four rotations of a block of the second values, so that one step compares all 16 pairs, and the block with
+ * the smaller last value is advanced. The values after the last full blocks are merged one by one.
+ *
+ * @return The number of values written to the output.
+ */
+template <SimdIntersectable Type>
+Size simdIntersect(std::span<const Type> first, std::span<const Type> second, Type *output) {
+    Size i = 0;
+    Size j = 0;
+    Size count = 0;
+    while (i + 4 <= first.size() && j + 4 <= second.size()) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first.data() + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(second.data() + j));
+        const __m128i rotated1 = _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 3, 2, 1));
+        const __m128i rotated2 = _mm_shuffle_epi32(b, _MM_SHUFFLE(1, 0, 3, 2));
+        const __m128i rotated3 = _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 1, 0, 3));
+        const __m128i equal01 = _mm_or_si128(_mm_cmpeq_epi32(a, b), _mm_cmpeq_epi32(a, rotated1));
+        const __m128i equal23 = _mm_or_si128(_mm_cmpeq_epi32(a, rotated2), _mm_cmpeq_epi32(a, rotated3));
+        const __m128i equal = _mm_or_si128(equal01, equal23);
+
+        for (auto mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(equal))); mask != 0;
+             mask &= mask - 1) {
+            output[count++] = first[i + std::countr_zero(mask)];
+        }
+
+        const Type firstLast = first[i + 3];
+        const Type secondLast = second[j + 3];
+        i += firstLast <= secondLast ? 4 : 0;
+        j += secondLast <= firstLast ? 4 : 0;
+    }
+
+    const auto rest = std::ranges::set_intersection(first.subspan(i), second.subspan(j), output + count);
+    return static_cast<Size>(rest.out - output);
+}
+
+#endif
+
+/**
+ * @brief Writes the values which are in both sorted sets to the output, in ascending order. 32 bit integers
+ * in contiguous memory are intersected with SSE2, see simdIntersect().
+ *
+ * @param output Must hold at least the size of the smaller set.
+ * @return The number of values written to the output.
+ */
+template <typename Type, SortedSetOf<Type> First, SortedSetOf<Type> Second>
+Size intersectSorted(const First &first, const Second &second, std::span<Type> output) {
+    requireOutputCapacity(output.size(), std::min(std::ranges::size(first), std::ranges::size(second)));
+#if GBASE_SIMD_SEARCH > 0
+    if constexpr (SimdIntersectable<Type> && std::ranges::contiguous_range<First> &&
+                  std::ranges::contiguous_range<Second>) {
+        return simdIntersect(std::span<const Type>{first}, std::span<const Type>{second}, output.data());
+    }
+#endif
+    const auto end = std::ranges::set_intersection(first, second, output.begin()).out;
+    return static_cast<Size>(end - output.begin());
+}
+
+/**
+ * @brief Writes the values which are in either of the sorted sets to the output, in ascending order.
+ *
+ * @param output Must hold at least the sizes of both sets.
+ * @return The number of values written to the output.
+ */
+template <typename Type, SortedSetOf<Type> First, SortedSetOf<Type> Second>
+Size uniteSorted(const First &first, const Second &second, std::span<Type> output) {
+    requireOutputCapacity(output.size(), std::ranges::size(first) + std::ranges::size(second));
+    const auto end = std::ranges::set_union(first, second, output.begin()).out;
+    return static_cast<Size>(end - output.begin());
+}
+
+/**
+ * @brief Writes the values of the first sorted set which are not in the second sorted set to the output,
+ * in ascending order.
+ *
+ * @param output Must hold at least the size of the first set.
+ * @return The number of values written to the output.
+ */
+template <typename Type, SortedSetOf<Type> First, SortedSetOf<Type> Second>
+Size differenceSorted(const First &first, const Second &second, std::span<Type> output) {
+    requireOutputCapacity(output.size(), std::ranges::size(first));
+    const auto end = std::ranges::set_difference(first, second, output.begin()).out;
+    return static_cast<Size>(end - output.begin());
+}
+
+/**
+ * @brief Writes the values which are in exactly one of the sorted sets to the output, in ascending order.
+ *
+ * @param output Must hold at least the sizes of both sets.
+ * @return The number of values written to the output.
+ */
+template <typename Type, SortedSetOf<Type> First, SortedSetOf<Type> Second>
+Size symmetricDifferenceSorted(const First &first, const Second &second, std::span<Type> output) {
+    requireOutputCapacity(output.size(), std::ranges::size(first) + std::ranges::size(second));
+    const auto end = std::ranges::set_symmetric_difference(first, second, output.begin()).out;
+    return static_cast<Size>(end - output.begin());
+}
+
+} // namespace gbase
@@ -0,0 +1,563 @@
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "g_basic_types.hpp"
+#include "g_exceptions.hpp"
+#include "g_search.hpp"
+
+namespace gbase {
+
+/**
+ * @brief A vector which stores up to InlineCapacity elements inside the object and moves them to the heap
+ * only when it grows beyond that. Has the same API as GVector, so small vectors of e.g. indices or the
+ * members of a record do not allocate.
+ *
+ * Iterators and references are invalidated when the elements move, i.e. when the vector grows beyond its
+ * capacity. A moved vector is left empty.
+ *
+ * Example usage:
+ * @code
+ * GSmallVector<Integer, 4> values{1, 2, 3};
+ * values += 4;        // Still inline
+ * values += 5;        // Moved to the heap
+ * @endcode
+ */
+template <typename Type, Size InlineCapacity> class GSmallVector {
+    static_assert(InlineCapacity > 0, "Use GVector for vectors without inline storage.");
+
+  public:
+    using value_type = Type;
+    using size_type = Size;
+    using difference_type = std::ptrdiff_t;
+    using reference = Type &;
+    using const_reference = const Type &;
+    using pointer = Type *;
+    using const_pointer = const Type *;
+    using iterator = Type *;
+    using const_iterator = const Type *;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    GSmallVector() = default;
+
+    // The constructors delegate to the default constructor, so the destructor releases the heap buffer if an
+    // element constructor throws.
+    explicit GSmallVector(Size count) : GSmallVector() { resize(count); }
+
+    GSmallVector(Size count, const Type &value) : GSmallVector() { resize(count, value); }
+
+    GSmallVector(std::initializer_list<Type> initList) : GSmallVector() { extend(initList); }
+
+    template <InputIteratorOf<Type> InputIt> GSmallVector(InputIt first, InputIt last) : GSmallVector() {
+        insert(end(), first, last);
+    }
+
+    template <RangeOf<Type> Range> explicit GSmallVector(const Range &range) : GSmallVector() {
+        extend(range);
+    }
+
+    GSmallVector(const GSmallVector &other) : GSmallVector() {
+        reserve(other.size());
+        std::uninitialized_copy(other.begin(), other.end(), data_);
+        size_ = other.size_;
+    }
+
+    GSmallVector(GSmallVector &&other) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+        moveFrom(std::move(other));
+    }
+
+    GSmallVector &operator=(const GSmallVector &other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size());
+            std::uninitialized_copy(other.begin(), other.end(), data_);
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    GSmallVector &operator=(GSmallVector &&other) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+        if (this != &other) {
+            clear();
+            releaseHeap();
+            moveFrom(std::move(other));
+        }
+        return *this;
+    }
+
+    GSmallVector &operator=(std::initializer_list<Type> initList) {
+        clear();
+        extend(initList);
+        return *this;
+    }
+
+    ~GSmallVector() {
+        clear();
+        releaseHeap();
+    }
+
+    iterator begin() { return data_; }
+    const_iterator begin() const { return data_; }
+    const_iterator cbegin() const { return data_; }
+    iterator end() { return data_ + size_; }
+    const_iterator end() const { return data_ + size_; }
+    const_iterator cend() const { return data_ + size_; }
+    reverse_iterator rbegin() { return reverse_iterator{end()}; }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator{end()}; }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator{end()}; }
+    reverse_iterator rend() { return reverse_iterator{begin()}; }
+    const_reverse_iterator rend() const { return const_reverse_iterator{begin()}; }
+    const_reverse_iterator crend() const { return const_reverse_iterator{begin()}; }
+
+    Type *data() { return data_; }
+    const Type *data() const { return data_; }
+
+    Size size() const { return size_; }
+    Size capacity() const { return capacity_; }
+    bool empty() const { return size_ == 0; }
+    Size maxSize() const { return std::numeric_limits<Size>::max() / sizeof(Type); }
+
+    /**
+     * @brief Tells if the elements are stored inside the object.
+     */
+    bool isInline() const { return data_ == inlineData(); }
+
+    Type &at(Size index) {
+        checkIndex(index);
+        return data_[index];
+    }
+
+    const Type &at(Size index) const {
+        checkIndex(index);
+        return data_[index];
+    }
+
+    /**
+     * @brief Custimized to raise an exception when index is out of range, unless GBASE_CHECKED_ACCESS is 0.
+     */
+    const Type &operator[](const Size &index) const {
+        if constexpr (CheckedAccess) {
+            checkIndex(index);
+        }
+        return data_[index];
+    }
+
+    /**
+     * @brief Custimized to raise an exception when index is out of range, unless GBASE_CHECKED_ACCESS is 0.
+     */
+    Type &operator[](const Size &index) {
+        if constexpr (CheckedAccess) {
+            checkIndex(index);
+        }
+        return data_[index];
+    }
+
+    /**
+     * @brief Gives the element without checking the index, also when GBASE_CHECKED_ACCESS is 1.
+     */
+    const Type &uncheckedAt(Size index) const { return data_[index]; }
+
+    /**
+     * @brief Gives the element without checking the index, also when GBASE_CHECKED_ACCESS is 1.
+     */
+    Type &uncheckedAt(Size index) { return data_[index]; }
+
+    /**
+     * @brief Gives a view of the contiguous elements.
+     */
+    std::span<const Type> span() const { return {data_, size_}; }
+
+    /**
+     * @brief Gives a view of the contiguous elements.
+     */
+    std::span<Type> span() { return {data_, size_}; }
+
+    Type &front() { return at(0); }
+    const Type &front() const { return at(0); }
+    Type &back() { return at(size_ - 1); }
+    const Type &back() const { return at(size_ - 1); }
+
+    void reserve(Size newCapacity) {
+        if (newCapacity > capacity_) {
+            relocate(newCapacity);
+        }
+    }
+
+    void clear() {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+
+    void resize(Size count) {
+        if (count < size_) {
+            erase(begin() + count, end());
+            return;
+        }
+        reserve(count);
+        std::uninitialized_value_construct(end(), data_ + count);
+        size_ = count;
+    }
+
+    void resize(Size count, const Type &value) {
+        if (count < size_) {
+            erase(begin() + count, end());
+            return;
+        }
+        reserve(count);
+        std::uninitialized_fill(end(), data_ + count, value);
+        size_ = count;
+    }
+
+    void pushBack(const Type &value) { emplaceBack(value); }
+    void pushBack(Type &&value) { emplaceBack(std::move(value)); }
+
+    template <typename... Args> Type &emplaceBack(Args &&...args) {
+        if (size_ == capacity_) {
+            // The arguments may refer to an element, so the new element is created before the old ones go.
+            relocate(grownCapacity(size_ + 1), 1,
+                     [&](Type *target) { std::construct_at(target, std::forward<Args>(args)...); });
+            return data_[size_ - 1];
+        }
+        std::construct_at(end(), std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+
+    void popBack() {
+        if (empty()) {
+            GTHROW(GOutOfRange, "popBack() on an empty vector.");
+        }
+        std::destroy_at(end() - 1);
+        --size_;
+    }
+
+    iterator insert(const_iterator position, const Type &value) {
+        const Size index = indexOf(position);
+        emplaceBack(value);
+        std::rotate(begin() + index, end() - 1, end());
+        return begin() + index;
+    }
+
+    template <std::input_iterator InputIt>
+    iterator insert(const_iterator position, InputIt first, InputIt last) {
+        const Size index = indexOf(position);
+        const Size oldSize = size_;
+        if constexpr (std::forward_iterator<InputIt>) {
+            const Size count = static_cast<Size>(std::distance(first, last));
+            if (size_ + count > capacity_) {
+                // The range may be part of this vector, so it is copied before the old elements go.
+                relocate(grownCapacity(size_ + count), count,
+                         [&](Type *target) { std::uninitialized_copy(first, last, target); });
+                first = last;
+            }
+        }
+        for (; first != last; ++first) {
+            emplaceBack(*first);
+        }
+        std::rotate(begin() + index, begin() + oldSize, end());
+        return begin() + index;
+    }
+
+    iterator erase(const_iterator position) { return erase(position, position + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        const Size index = indexOf(first);
+        const Size count = indexOf(last) - index;
+        if (count > 0) {
+            std::move(begin() + index + count, end(), begin() + index);
+            std::destroy(end() - count, end());
+            size_ -= count;
+        }
+        return begin() + index;
+    }
+
+    void swap(GSmallVector &other) {
+        GSmallVector temporary{std::move(other)};
+        other = std::move(*this);
+        *this = std::move(temporary);
+    }
+
+    bool operator==(const GSmallVector &other) const { return std::ranges::equal(*this, other); }
+
+    auto operator<=>(const GSmallVector &other) const {
+        return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end());
+    }
+
+    /**
+     * @brief Searches for a value in the vector, see GVector::find().
+     * @return The index of the first value found, or std::nullopt if the value was not found.
+     */
+    std::optional<Size> find(const Type &value) const { return findValue(span(), value); }
+
+    /**
+     * @brief Gives the indices of all values equal to the value, in ascending order.
+     */
+    GSmallVector<Size, InlineCapacity> findAll(const Type &value) const {
+        GSmallVector<Size, InlineCapacity> indices;
+        forEachIndexOf(span(), value, [&indices](Size index) { indices.pushBack(index); });
+        return indices;
+    }
+
+    /**
+     * @brief Counts the values equal to the value.
+     */
+    Size count(const Type &value) const { return countValue(span(), value); }
+
+    /**
+     * @brief Searches for any of the candidates in the vector.
+     * @return The index of the first value equal to one of the candidates, or std::nullopt if there is none.
+     */
+    std::optional<Size> findFirstOf(std::span<const Type> candidates) const {
+        return gbase::findFirstOf(span(), candidates);
+    }
+
+    /**
+     * @brief Appends the provided value to the end of the vector.
+     */
+    void extend(const Type &newValue) { pushBack(newValue); }
+
+    /**
+     * @brief Appends the provided value to the end of the vector.
+     */
+    void operator+=(const Type &newValue) { extend(newValue); }
+
+    /**
+     * @brief Appends the provided value to a copy of this vector and returns the result.
+     */
+    GSmallVector operator+(const Type &newValue) const & {
+        GSmallVector copy{*this};
+        copy.extend(newValue);
+        return copy;
+    }
+
+    /**
+     * @brief Appends the provided value to this temporary vector and returns it without copying.
+     */
+    GSmallVector operator+(const Type &newValue) && {
+        extend(newValue);
+        return std::move(*this);
+    }
+
+    /**
+     * @brief Appends the provided range to the end of the vector.
+     */
+    template <RangeOf<Type> Range> void extend(const Range &values) {
+        insert(end(), std::ranges::begin(values), std::ranges::end(values));
+    }
+
+    /**
+     * @brief Appends the provided range to the end of the vector.
+     */
+    template <RangeOf<Type> Range> void operator+=(const Range &values) { extend(values); }
+
+    /**
+     * @brief Appends the provided range to a copy of this vector and returns the result.
+     */
+    template <RangeOf<Type> Range> GSmallVector operator+(const Range &values) const & {
+        GSmallVector copy{*this};
+        copy.extend(values);
+        return copy;
+    }
+
+    /**
+     * @brief Appends the provided range to this temporary vector and returns it without copying.
+     */
+    template <RangeOf<Type> Range> GSmallVector operator+(const Range &values) && {
+        extend(values);
+        return std::move(*this);
+    }
+
+    /**
+     * @brief Appends the provided initializer list to the end of the vector.
+     */
+    void extend(std::initializer_list<Type> initList) { insert(end(), initList.begin(), initList.end()); }
+
+    /**
+     * @brief Appends the provided initializer list to the end of the vector.
+     */
+    void operator+=(std::initializer_list<Type> initList) { extend(initList); }
+
+    /**
+     * @brief Appends the provided initializer list to a copy of this vector and returns the result.
+     */
+    GSmallVector operator+(std::initializer_list<Type> initList) const & {
+        GSmallVector copy{*this};
+        copy.extend(initList);
+        return copy;
+    }
+
+    /**
+     * @brief Appends the provided initializer list to this temporary vector and returns it without copying.
+     */
+    GSmallVector operator+(std::initializer_list<Type> initList) && {
+        extend(initList);
+        return std::move(*this);
+    }
+
+    /**
+     * @brief Sorts the contents of this vector.
+     *
+     * @param compareFn The default sort function is 'a < b', i.e. ascending order.
+     */
+    template <typename Compare = std::ranges::less> void sort(Compare compareFn = {}) {
+        std::ranges::sort(*this, compareFn);
+    }
+
+    /**
+     * @brief Returns a sorted copy of this vector.
+     *
+     * @param compareFn The default sort function is 'a < b', i.e. ascending order.
+     */
+    template <typename Compare = std::ranges::less> GSmallVector sort(Compare compareFn = {}) const {
+        GSmallVector result{*this};
+        std::ranges::sort(result, compareFn);
+        return result;
+    }
+
+    /**
+     * @brief Circular rotation of the contents of the vector.
+     *
+     * @param steps Rotates to the right for positive steps and to the left for negative steps.
+     */
+    void rotate(Integer steps) {
+        if (empty()) {
+            return;
+        }
+        steps = steps % static_cast<Integer>(size());
+
+        if (steps == 0) {
+            return;
+        }
+
+        if (steps > 0) {
+            // Rotate right
+            std::rotate(rbegin(), rbegin() + steps, rend());
+            return;
+        }
+
+        // Rotate left
+        std::rotate(begin(), begin() - steps, end());
+    }
+
+    /**
+     * @brief Prints a textual representation of the vector.
+     */
+    void print(std::ostream &target) const {
+        target << '[';
+
+        if (!empty()) {
+            auto it = begin();
+            target << *it++;
+
+            while (it != end()) {
+                target << ", " << *it++;
+            }
+        }
+
+        target << ']';
+    }
+
+  private:
+    Type *inlineData() { return std::launder(reinterpret_cast<Type *>(inline_)); }
+    const Type *inlineData() const { return std::launder(reinterpret_cast<const Type *>(inline_)); }
+
+    void checkIndex(Size index) const {
+        if (index >= size_) {
+            GTHROW(GOutOfRange, "Index ", index, " is out of range for size ", size_, ".");
+        }
+    }
+
+    Size indexOf(const_iterator position) const { return static_cast<Size>(position - cbegin()); }
+
+    Size grownCapacity(Size required) const { return std::max(required, 2 * capacity_); }
+
+    /**
+     * @brief Deallocates a heap buffer which has no elements, e.g. when moving the elements into it throws.
+     */
+    struct HeapDeleter {
+        Size capacity;
+
+        void operator()(Type *buffer) const { std::allocator<Type>{}.deallocate(buffer, capacity); }
+    };
+
+    /**
+     * @brief Moves the elements to a heap buffer of the given capacity.
+     */
+    void relocate(Size newCapacity) { relocate(newCapacity, 0, [](Type *) {}); }
+
+    /**
+     * @brief Moves the elements to a heap buffer of the given capacity, after append has constructed the
+     * given number of new elements behind them, so the new elements may be copied from the old ones. Like
+     * std::vector, the elements are copied instead if moving them may throw, so the vector is unchanged if
+     * a constructor throws.
+     */
+    template <typename Append> void relocate(Size newCapacity, Size appended, Append append) {
+        std::unique_ptr<Type, HeapDeleter> buffer{std::allocator<Type>{}.allocate(newCapacity),
+                                                  HeapDeleter{newCapacity}};
+        append(buffer.get() + size_);
+        try {
+            if constexpr (std::is_nothrow_move_constructible_v<Type> || !std::is_copy_constructible_v<Type>) {
+                std::uninitialized_move(begin(), end(), buffer.get());
+            } else {
+                std::uninitialized_copy(begin(), end(), buffer.get());
+            }
+        } catch (...) {
+            std::destroy_n(buffer.get() + size_, appended);
+            throw;
+        }
+        std::destroy(begin(), end());
+        releaseHeap();
+        data_ = buffer.release();
+        capacity_ = newCapacity;
+        size_ += appended;
+    }
+
+    void releaseHeap() {
+        if (!isInline()) {
+            std::allocator<Type>{}.deallocate(data_, capacity_);
+            data_ = inlineData();
+            capacity_ = InlineCapacity;
+        }
+    }
+
+    /**
+     * @brief Takes the elements of the other vector. This vector must be empty and use its inline storage.
+     */
+    void moveFrom(GSmallVector &&other) {
+        if (other.isInline()) {
+            std::uninitialized_move(other.begin(), other.end(), data_);
+            size_ = other.size_;
+            other.clear();
+            return;
+        }
+        data_ = std::exchange(other.data_, other.inlineData());
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, InlineCapacity);
+    }
+
+    alignas(Type) std::byte inline_[InlineCapacity * sizeof(Type)];
+    Type *data_{inlineData()};
+    Size size_{0};
+    Size capacity_{InlineCapacity};
+};
+
+template <typename Type, Size InlineCapacity>
+std::ostream &operator<<(std::ostream &s, const GSmallVector<Type, InlineCapacity> &v) {
+    v.print(s);
+    return s;
+}
+
+} // namespace gbase
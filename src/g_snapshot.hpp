@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "g_basic_types.hpp"
+#include "g_circular_buffers.hpp"
+
+namespace gbase {
+
+/**
+ * @brief Holds a value which many threads read without locking while other threads replace it, i.e. a
+ * read-copy-update cell.
+ *
+ * Readers get an immutable snapshot of the value with read(). Writers call update(), which copies the
+ * current value, applies the change to the copy and publishes it. update() then waits until all readers
+ * which may still see the previous value are done, so once update() returns nothing uses the previous value
+ * any more. Readers never wait for writers; a reader only retries registering itself if a writer publishes
+ * a value at the same moment.
+ *
+ * Writers publish one at a time, but wait without holding the lock which serialises publishing. update()
+ * may be called while the calling thread itself reads the cell, e.g. from a callback invoked through a
+ * snapshot. It then only waits for the other threads, and the previous value is released by a later update().
+ * If another writer is still waiting for readers at that moment, possibly for the calling thread, update()
+ * publishes without waiting at all.
+ *
+ * Example usage:
+ * @code
+ * GSnapshotCell<std::vector<Integer>> cell;
+ * cell.update([](auto &values) { values.push_back(1); });
+ * for (const auto value : *cell.read()) {}
+ * @endcode
+ */
+template <typename Value> class GSnapshotCell {
+  public:
+    /**
+     * @brief Keeps a snapshot alive while it is in scope. Must be destroyed on the thread that created it.
+     */
+    class ReadGuard {
+      public:
+        ReadGuard(const ReadGuard &) = delete;
+        ReadGuard &operator=(const ReadGuard &) = delete;
+
+        ~ReadGuard() {
+            activeReads().pop_back();
+            cell_.readers_[parity_].count.fetch_sub(1, std::memory_order_release);
+        }
+
+        const Value &operator*() const { return *value_; }
+        const Value *operator->() const { return value_; }
+
+      private:
+        friend class GSnapshotCell;
+
+        ReadGuard(const GSnapshotCell &cell) : cell_{cell} {
+            for (;;) {
+                const Unsigned epoch = cell_.epoch_.load(std::memory_order_seq_cst);
+                parity_ = epoch & 1;
+                cell_.readers_[parity_].count.fetch_add(1, std::memory_order_seq_cst);
+                if (cell_.epoch_.load(std::memory_order_seq_cst) == epoch) {
+                    break;
+                }
+                cell_.readers_[parity_].count.fetch_sub(1, std::memory_order_release);
+            }
+            activeReads().push_back({&cell_, parity_});
+            value_ = cell_.value_.load(std::memory_order_acquire);
+        }
+
+        const GSnapshotCell &cell_;
+        Unsigned parity_{0};
+        const Value *value_{nullptr};
+    };
+
+    GSnapshotCell() : GSnapshotCell{Value{}} {}
+
+    explicit GSnapshotCell(Value value) : value_{new Value(std::move(value))} {}
+
+    GSnapshotCell(const GSnapshotCell &) = delete;
+    GSnapshotCell &operator=(const GSnapshotCell &) = delete;
+
+    /**
+     * @brief Must not be destroyed while other threads read the cell.
+     */
+    ~GSnapshotCell() { delete value_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Gives the current value. The value does not change while the guard is alive, even if update()
+     * is called.
+     */
+    ReadGuard read() const { return ReadGuard{*this}; }
+
+    /**
+     * @brief Replaces the value by a copy which change has been applied to, and waits until no other thread
+     * reads the previous value. Does not wait if the calling thread reads the cell while another writer
+     * waits.
+     */
+    template <typename Change> void update(Change &&change) {
+        const bool reading = countOwnReads(0) + countOwnReads(1) != 0;
+        std::unique_lock waitLock{waitMutex_, std::defer_lock};
+        if (!reading) {
+            waitLock.lock();
+        } else if (!waitLock.try_lock()) {
+            // The waiting writer may wait for this thread, so the previous value is left to its successor.
+            std::lock_guard lock{publishMutex_};
+            retired_.push_back(publish(change));
+            return;
+        }
+
+        std::unique_ptr<const Value> previous;
+        std::vector<std::unique_ptr<const Value>> released;
+        Unsigned parity = 0;
+        {
+            std::lock_guard lock{publishMutex_};
+            previous = publish(change);
+            const Unsigned epoch = epoch_.load(std::memory_order_relaxed);
+            epoch_.store(epoch + 1, std::memory_order_seq_cst);
+            parity = epoch & 1;
+            if (reading) {
+                retired_.push_back(std::move(previous));
+            } else {
+                released.swap(retired_);
+            }
+        }
+
+        const Size ownReads = countOwnReads(parity);
+        while (readers_[parity].count.load(std::memory_order_seq_cst) > ownReads) {
+            std::this_thread::yield();
+        }
+    }
+
+  private:
+    struct ActiveRead {
+        const void *cell;
+        Unsigned parity;
+    };
+
+    struct alignas(CacheLineSize) ReaderCount {
+        std::atomic<Size> count{0};
+    };
+
+    /**
+     * @brief The snapshots the calling thread reads right now, innermost last.
+     */
+    static std::vector<ActiveRead> &activeReads() {
+        static thread_local std::vector<ActiveRead> reads;
+        return reads;
+    }
+
+    /**
+     * @brief Publishes a changed copy of the value and gives the previous value. Requires publishMutex_.
+     */
+    template <typename Change> std::unique_ptr<const Value> publish(Change &change) {
+        auto next = std::make_unique<Value>(*value_.load(std::memory_order_relaxed));
+        change(*next);
+        return std::unique_ptr<const Value>{value_.exchange(next.release(), std::memory_order_acq_rel)};
+    }
+
+    Size countOwnReads(Unsigned parity) const {
+        return static_cast<Size>(std::ranges::count_if(activeReads(), [this, parity](const ActiveRead &read) {
+            return read.cell == this && read.parity == parity;
+        }));
+    }
+
+    std::atomic<const Value *> value_;
+    std::atomic<Unsigned> epoch_{0};
+    mutable std::array<ReaderCount, 2> readers_;
+    std::mutex publishMutex_;
+    std::mutex waitMutex_;
+    std::vector<std::unique_ptr<const Value>> retired_;
+};
+
+} // namespace gbase
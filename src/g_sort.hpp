@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "g_basic_types.hpp"
+
+namespace gbase {
+
+/**
+ * @brief Types which radixSort() sorts by the bits of their values: integers and IEEE 754 float and double.
+ */
+template <typename Type>
+concept RadixSortable = (std::integral<Type> && !std::same_as<Type, bool>) ||
+                        (std::floating_point<Type> && std::numeric_limits<Type>::is_iec559 &&
+                         (sizeof(Type) == 4 || sizeof(Type) == 8));
+
+/**
+ * @brief Below this number of elements radixSort() uses a comparison sort, which is faster for few elements.
+ */
+constexpr Size RadixSortThreshold = 256;
+
+/**
+ * @brief Tells if the comparator sorts in ascending order by operator<, so a sort may use radixSort().
+ */
+template <typename Compare, typename Type>
+constexpr bool IsAscendingCompare =
+    std::is_same_v<Compare, std::ranges::less> || std::is_same_v<Compare, std::less<>> ||
+    std::is_same_v<Compare, std::less<Type>>;
+
+/**
+ * @brief The unsigned integer with the same size as the type.
+ */
+template <typename Type>
+using RadixKey = std::conditional_t<
+    sizeof(Type) == 1, std::uint8_t,
+    std::conditional_t<sizeof(Type) == 2, std::uint16_t,
+                       std::conditional_t<sizeof(Type) == 4, std::uint32_t, std::uint64_t>>>;
+
+/**
+ * @brief Maps the value to an unsigned key with the same order, i.e. a < b if and only if key(a) < key(b).
+ */
+template <RadixSortable Type> auto radixKey(Type value) {
+    using Key = RadixKey<Type>;
+    constexpr Key signBit = Key{1} << (std::numeric_limits<Key>::digits - 1);
+
+    if constexpr (std::floating_point<Type>) {
+        // Negative values have the sign bit set and larger magnitudes are smaller, so all bits are flipped.
+        const Key bits = std::bit_cast<Key>(value);
+        return static_cast<Key>((bits & signBit) != 0 ? ~bits : bits | signBit);
+    } else if constexpr (std::is_signed_v<Type>) {
+        return static_cast<Key>(static_cast<Key>(value) ^ signBit);
+    } else {
+        return static_cast<Key>(value);
+    }
+}
+
+/**
+ * @brief Sorts the values in ascending order with a least significant digit radix sort, one pass per byte
+ * of the values. Passes over bytes which are equal in all values are skipped, and an auxiliary buffer of the
+ * same size as the values is allocated.
+ *
+ * Negative zero is placed before positive zero, and NaNs are placed first or last depending on their sign.
+ */
+template <RadixSortable Type> void radixSort(std::span<Type> values) {
+    if (values.size() < RadixSortThreshold) {
+        std::ranges::sort(values);
+        return;
+    }
+
+    constexpr Size Passes = sizeof(Type);
+    constexpr Size Buckets = 256;
+    constexpr Size BitsPerPass = 8;
+
+    std::array<std::array<Size, Buckets>, Passes> counts{};
+    for (const Type value : values) {
+        const auto key = radixKey(value);
+        for (Size pass = 0; pass < Passes; ++pass) {
+            ++counts[pass][(key >> (pass * BitsPerPass)) & (Buckets - 1)];
+        }
+    }
+
+    std::vector<Type> buffer(values.size());
+    std::span<Type> source = values;
+    std::span<Type> target{buffer};
+
+    for (Size pass = 0; pass < Passes; ++pass) {
+        auto &passCounts = counts[pass];
+        if (std::ranges::find(passCounts, values.size()) != passCounts.end()) {
+            continue;
+        }
+
+        std::array<Size, Buckets> offsets;
+        std::exclusive_scan(passCounts.begin(), passCounts.end(), offsets.begin(), Size{0});
+        for (const Type value : source) {
+            const Size bucket = (radixKey(value) >> (pass * BitsPerPass)) & (Buckets - 1);
+            target[offsets[bucket]++] = value;
+        }
+        std::swap(source, target);
+    }
+
+    if (source.data() != values.data()) {
+        std::ranges::copy(source, values.begin());
+    }
+}
+
+} // namespace gbase
@@ -1,6 +1,12 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <format>
+#include <mutex>
+#include <string_view>
+#include <thread>
 
 #include "g_basic_types.hpp"
 
@@ -9,6 +15,9 @@ namespace gbase {
 constexpr Integer SecondsPerMinute = 60;
 constexpr Integer MillisecondsPerSecond = 1000;
 constexpr Integer MillisecondsPerMinute = SecondsPerMinute * MillisecondsPerSecond;
+constexpr Integer MinutesPerHour = 60;
+constexpr Integer HoursPerDay = 24;
+constexpr Integer MillisecondsPerDay = HoursPerDay * MinutesPerHour * MillisecondsPerMinute;
 
 struct GTimeOfDay {
     Integer hours{0};
@@ -26,6 +35,20 @@ class GUTCTime {
   public:
     static GUTCTime now() { return GUTCTime{std::chrono::system_clock::now()}; }
 
+    /**
+     * @brief Creates the time which is the given duration after the epoch of std::chrono::system_clock.
+     */
+    static GUTCTime fromTimeSinceEpoch(std::chrono::nanoseconds sinceEpoch) {
+        return GUTCTime{Timepoint{std::chrono::duration_cast<Timepoint::duration>(sinceEpoch)}};
+    }
+
+    /**
+     * @brief Gives the duration since the epoch of std::chrono::system_clock.
+     */
+    std::chrono::nanoseconds timeSinceEpoch() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(timepoint_.time_since_epoch());
+    }
+
     GTimeOfDay timeOfDay() const {
         const auto timeOfDay = timepoint_.time_since_epoch() % std::chrono::days(1);
         const auto hhmmss = std::chrono::hh_mm_ss(timeOfDay);
@@ -47,4 +70,130 @@ class GUTCTime {
     Timepoint timepoint_;
 };
 
+/**
+ * @brief Gives the current time of day as "HH:MM:SS:mmm" text without formatting it for every call.
+ *
+ * Each thread keeps the text of the last millisecond it asked for and renders it again only when the
+ * millisecond has changed, so logging many lines per millisecond formats the timestamp once. By default each
+ * call reads std::chrono::system_clock; after startTicker() a background thread reads the clock instead and
+ * the calls only load an atomic, at the cost of a resolution of the ticker period.
+ *
+ * Example usage:
+ * @code
+ * std::string_view timestamp = gbase::GTimestampCache::now(); // E.g. "13:45:07:042"
+ * @endcode
+ */
+class GTimestampCache {
+  public:
+    static constexpr Size Length = 12;
+
+    using Text = std::array<Char, Length>;
+
+    /**
+     * @brief Gives the current UTC time of day as "HH:MM:SS:mmm". The view stays valid until the next call
+     * from the same thread.
+     */
+    static std::string_view now() {
+        static thread_local ThreadCache cache;
+        const Integer tick = currentTick();
+        if (tick != cache.tick) {
+            cache.tick = tick;
+            cache.text = render(std::chrono::milliseconds{tick});
+        }
+        return {cache.text.data(), Length};
+    }
+
+    /**
+     * @brief Renders the time of day of given time since the epoch of std::chrono::system_clock as
+     * "HH:MM:SS:mmm", the same text as GTimeOfDay::toString().
+     */
+    static constexpr Text render(std::chrono::milliseconds timeSinceEpoch) {
+        Integer millisecondsOfDay = static_cast<Integer>(timeSinceEpoch.count() % MillisecondsPerDay);
+        if (millisecondsOfDay < 0) {
+            millisecondsOfDay += MillisecondsPerDay;
+        }
+        const Integer milliseconds = millisecondsOfDay % MillisecondsPerSecond;
+        const Integer seconds = millisecondsOfDay / MillisecondsPerSecond % SecondsPerMinute;
+        const Integer minutes = millisecondsOfDay / MillisecondsPerMinute % MinutesPerHour;
+        const Integer hours = millisecondsOfDay / (MillisecondsPerMinute * MinutesPerHour);
+
+        Text text{'0', '0', ':', '0', '0', ':', '0', '0', ':', '0', '0', '0'};
+        const auto put = [&text](Size end, Integer value) {
+            for (Size i = end; value != 0; value /= 10) {
+                text[--i] = static_cast<Char>('0' + value % 10);
+            }
+        };
+        put(2, hours);
+        put(5, minutes);
+        put(8, seconds);
+        put(12, milliseconds);
+        return text;
+    }
+
+    /**
+     * @brief Starts a background thread which reads the clock once per period for now(). Does nothing if
+     * the ticker is already running.
+     */
+    static void startTicker(std::chrono::milliseconds period = std::chrono::milliseconds{1}) {
+        Ticker &ticker = getTicker();
+        std::lock_guard lock{ticker.mutex};
+        if (ticker.thread.joinable()) {
+            return;
+        }
+        ticker.tick.store(clockTick(), std::memory_order_relaxed);
+        ticker.thread = std::jthread{[&ticker, period](std::stop_token stop) {
+            while (!stop.stop_requested()) {
+                std::this_thread::sleep_for(period);
+                ticker.tick.store(clockTick(), std::memory_order_relaxed);
+            }
+        }};
+        ticker.running.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Stops the ticker thread, so now() reads the clock again.
+     */
+    static void stopTicker() {
+        Ticker &ticker = getTicker();
+        std::lock_guard lock{ticker.mutex};
+        ticker.running.store(false, std::memory_order_release);
+        ticker.thread = std::jthread{};
+    }
+
+    static bool isTickerRunning() { return getTicker().running.load(std::memory_order_acquire); }
+
+  private:
+    struct ThreadCache {
+        Integer tick{-1};
+        Text text{};
+    };
+
+    struct Ticker {
+        std::mutex mutex;
+        std::jthread thread;
+        std::atomic<bool> running{false};
+        std::atomic<Integer> tick{0};
+    };
+
+    static Ticker &getTicker() {
+        static Ticker ticker;
+        return ticker;
+    }
+
+    /**
+     * @brief Gives the milliseconds since the epoch modulo one day, which is all that now() needs.
+     */
+    static Integer clockTick() {
+        const auto sinceEpoch = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch());
+        return static_cast<Integer>(sinceEpoch.count() % MillisecondsPerDay);
+    }
+
+    static Integer currentTick() {
+        const Ticker &ticker = getTicker();
+        return ticker.running.load(std::memory_order_acquire) ? ticker.tick.load(std::memory_order_relaxed)
+                                                              : clockTick();
+    }
+};
+
 } // namespace gbase
\ No newline at end of file
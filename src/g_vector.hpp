@@ -2,33 +2,55 @@
 #pragma once
 
 #include <algorithm>
+#include <execution>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 #include "g_basic_types.hpp"
+#include "g_search.hpp"
+#include "g_sort.hpp"
 
 namespace gbase {
 
 /**
  * @brief Template class based on std::vector but with some additions and modificatons.
+ *
+ * The allocator is passed on to std::vector. Copies made by the operators use the allocator of this vector,
+ * so e.g. a pmr::GVector and the results computed from it stay in the same memory resource.
  */
-template <typename Type> class GVector : private std::vector<Type> {
+template <typename Type, typename Allocator = std::allocator<Type>>
+class GVector : private std::vector<Type, Allocator> {
   private:
-    using base = std::vector<Type>;
-    constexpr static bool defaultCompare(const Type &a, const Type &b) { return a < b; };
+    using base = std::vector<Type, Allocator>;
 
   public:
     using base::vector; // Using standard vector constructors.
 
-    constexpr GVector(std::initializer_list<Type> initList) : base(initList) {}
+    constexpr GVector(std::initializer_list<Type> initList, const Allocator &allocator = Allocator())
+        : base(initList, allocator) {}
 
     template <InputIteratorOf<Type> InputIt>
-    constexpr GVector(InputIt first, InputIt last) : base(first, last){};
+    constexpr GVector(InputIt first, InputIt last, const Allocator &allocator = Allocator())
+        : base(first, last, allocator){};
 
     template <RangeOf<Type> Range>
-    explicit constexpr GVector(const Range &range) : base(std::begin(range), std::end(range)){};
+    explicit constexpr GVector(const Range &range, const Allocator &allocator = Allocator())
+        : base(std::begin(range), std::end(range), allocator){};
+
+    constexpr GVector(const GVector &other) = default;
+    constexpr GVector(GVector &&other) noexcept = default;
+    constexpr GVector(const GVector &other, const Allocator &allocator) : base(other, allocator) {}
+    constexpr GVector(GVector &&other, const Allocator &allocator) : base(std::move(other), allocator) {}
+
+    constexpr GVector &operator=(const GVector &other) = default;
+    constexpr GVector &operator=(GVector &&other) = default;
 
     ~GVector() = default;
 
@@ -69,6 +91,7 @@ template <typename Type> class GVector : private std::vector<Type> {
     using base::insert;
     using base::rbegin;
     using base::rend;
+    using base::reserve;
     using base::resize;
     using base::size;
     using base::swap;
@@ -83,27 +106,74 @@ template <typename Type> class GVector : private std::vector<Type> {
     bool operator!=(const GVector &other) const = default;
 
     /**
-     * @brief Custimized to raise an exception when index is out of range.
+     * @brief Custimized to raise an exception when index is out of range, unless GBASE_CHECKED_ACCESS is 0.
      */
-    const Type &operator[](const Size &index) const { return at(index); }
+    const Type &operator[](const Size &index) const {
+        if constexpr (CheckedAccess) {
+            return at(index);
+        } else {
+            return base::operator[](index);
+        }
+    }
 
     /**
-     * @brief Custimized to raise an exception when index is out of range.
+     * @brief Custimized to raise an exception when index is out of range, unless GBASE_CHECKED_ACCESS is 0.
      */
-    Type &operator[](const Size &index) { return at(index); }
+    Type &operator[](const Size &index) {
+        if constexpr (CheckedAccess) {
+            return at(index);
+        } else {
+            return base::operator[](index);
+        }
+    }
 
     /**
-     * @brief Searches for a value in the vector.
-     * @return The index of the first value found, or -1 if the value was not found.
+     * @brief Gives the element without checking the index, also when GBASE_CHECKED_ACCESS is 1.
      */
-    constexpr Integer find(const Type &value) const {
-        for (Size i = 0; i < size(); ++i) {
-            if (at(i) == value) {
-                return i;
-            }
-        }
+    const Type &uncheckedAt(Size index) const { return base::operator[](index); }
 
-        return -1;
+    /**
+     * @brief Gives the element without checking the index, also when GBASE_CHECKED_ACCESS is 1.
+     */
+    Type &uncheckedAt(Size index) { return base::operator[](index); }
+
+    /**
+     * @brief Gives a view of the contiguous elements, e.g. for loops which the compiler shall vectorize.
+     */
+    std::span<const Type> span() const { return {data(), size()}; }
+
+    /**
+     * @brief Gives a view of the contiguous elements, e.g. for loops which the compiler shall vectorize.
+     */
+    std::span<Type> span() { return {data(), size()}; }
+
+    /**
+     * @brief Searches for a value in the vector. Integers, floats and doubles are compared a SIMD register at
+     * a time, see findValue().
+     * @return The index of the first value found, or std::nullopt if the value was not found.
+     */
+    std::optional<Size> find(const Type &value) const { return findValue(span(), value); }
+
+    /**
+     * @brief Gives the indices of all values equal to the value, in ascending order.
+     */
+    GVector<Size> findAll(const Type &value) const {
+        GVector<Size> indices;
+        forEachIndexOf(span(), value, [&indices](Size index) { indices.pushBack(index); });
+        return indices;
+    }
+
+    /**
+     * @brief Counts the values equal to the value.
+     */
+    Size count(const Type &value) const { return countValue(span(), value); }
+
+    /**
+     * @brief Searches for any of the candidates in the vector.
+     * @return The index of the first value equal to one of the candidates, or std::nullopt if there is none.
+     */
+    std::optional<Size> findFirstOf(std::span<const Type> candidates) const {
+        return gbase::findFirstOf(span(), candidates);
     }
 
     /**
@@ -119,10 +189,18 @@ template <typename Type> class GVector : private std::vector<Type> {
     /**
      * @brief Appends the provided value to a copy of this vector and returns the result.
      */
-    constexpr GVector<Type> operator+(const Type &newValue) {
-        GVector<Type> copy{*this};
-        copy.extend(newValue);
-        return copy;
+    constexpr GVector operator+(const Type &newValue) const & {
+        GVector result = copyWithCapacity(size() + 1);
+        result.extend(newValue);
+        return result;
+    }
+
+    /**
+     * @brief Appends the provided value to this temporary vector and returns it without copying.
+     */
+    constexpr GVector operator+(const Type &newValue) && {
+        extend(newValue);
+        return std::move(*this);
     }
 
     /**
@@ -140,10 +218,22 @@ template <typename Type> class GVector : private std::vector<Type> {
     /**
      * @brief Appends the provided range to a copy of this vector and returns the result.
      */
-    template <RangeOf<Type> Range> constexpr GVector<Type> operator+(const Range &values) const {
-        GVector<Type> copy{*this};
-        copy.extend(values);
-        return copy;
+    template <RangeOf<Type> Range> constexpr GVector operator+(const Range &values) const & {
+        Size combinedSize = size();
+        if constexpr (std::ranges::sized_range<Range>) {
+            combinedSize += std::ranges::size(values);
+        }
+        GVector result = copyWithCapacity(combinedSize);
+        result.extend(values);
+        return result;
+    }
+
+    /**
+     * @brief Appends the provided range to this temporary vector and returns it without copying.
+     */
+    template <RangeOf<Type> Range> constexpr GVector operator+(const Range &values) && {
+        extend(values);
+        return std::move(*this);
     }
 
     /**
@@ -161,18 +251,34 @@ template <typename Type> class GVector : private std::vector<Type> {
     /**
      * @brief Appends the provided initializer list to a copy of this vector and returns the result.
      */
-    constexpr const GVector<Type> operator+(std::initializer_list<Type> initList) const {
-        GVector<Type> copy{*this};
-        copy.insert(copy.end(), initList.begin(), initList.end());
+    constexpr GVector operator+(std::initializer_list<Type> initList) const & {
+        GVector result = copyWithCapacity(size() + initList.size());
+        result.extend(initList);
+        return result;
     }
 
     /**
-     * @brief Sorts the contents of this vector.
+     * @brief Appends the provided initializer list to this temporary vector and returns it without copying.
+     */
+    constexpr GVector operator+(std::initializer_list<Type> initList) && {
+        extend(initList);
+        return std::move(*this);
+    }
+
+    /**
+     * @brief Sorts the contents of this vector. Integers, floats and doubles are sorted with radixSort() when
+     * sorted in ascending order.
      *
      * @param compareFn The default sort function is 'a < b', i.e. ascending order.
      */
-    void constexpr sort(std::function<bool(Type, Type)> compareFn = defaultCompare) {
-        std::ranges::sort(*this, compareFn);
+    template <typename Compare = std::ranges::less>
+        requires(!std::is_execution_policy_v<std::remove_cvref_t<Compare>>)
+    constexpr void sort(Compare compareFn = {}) {
+        if constexpr (RadixSortable<Type> && IsAscendingCompare<Compare, Type>) {
+            radixSort(span());
+        } else {
+            std::ranges::sort(*this, compareFn);
+        }
     }
 
     /**
@@ -180,12 +286,24 @@ template <typename Type> class GVector : private std::vector<Type> {
      *
      * @param compareFn The default sort function is 'a < b', i.e. ascending order.
      */
-    GVector<Type> constexpr sort(std::function<bool(Type, Type)> compareFn = defaultCompare) const {
-        GVector result{*this};
-        std::ranges::sort(result, compareFn);
+    template <typename Compare = std::ranges::less>
+        requires(!std::is_execution_policy_v<std::remove_cvref_t<Compare>>)
+    constexpr GVector sort(Compare compareFn = {}) const {
+        GVector result(*this, get_allocator());
+        result.sort(compareFn);
         return result;
     }
 
+    /**
+     * @brief Sorts the contents of this vector with the given execution policy, e.g. std::execution::par for
+     * a parallel sort of large vectors.
+     */
+    template <typename ExecutionPolicy, typename Compare = std::ranges::less>
+        requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    void sort(ExecutionPolicy &&policy, Compare compareFn = {}) {
+        std::sort(std::forward<ExecutionPolicy>(policy), begin(), end(), compareFn);
+    }
+
     /**
      * @brief Circular rotation of the contents of the vector.
      *
@@ -225,11 +343,32 @@ template <typename Type> class GVector : private std::vector<Type> {
 
         target << ']';
     }
+
+  private:
+    /**
+     * @brief Copies this vector into a new vector which has room for the given number of elements.
+     */
+    constexpr GVector copyWithCapacity(Size capacity) const {
+        GVector result(get_allocator());
+        result.reserve(capacity);
+        result.insert(result.end(), begin(), end());
+        return result;
+    }
 };
 
-template <typename Type> constexpr std::ostream &operator<<(std::ostream &s, const GVector<Type> &v) {
+template <typename Type, typename Allocator>
+constexpr std::ostream &operator<<(std::ostream &s, const GVector<Type, Allocator> &v) {
     v.print(s);
     return s;
 }
 
+namespace pmr {
+
+/**
+ * @brief A GVector which allocates from a std::pmr::memory_resource, e.g. an arena.
+ */
+template <typename Type> using GVector = gbase::GVector<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace gbase
\ No newline at end of file
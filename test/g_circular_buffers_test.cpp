@@ -20,4 +20,22 @@ GTEST(GCircularBuffersTest) {
     }
 }
 
+GTEST(GRingBufferTest) {
+    GRingBuffer<Integer> buffer{3};
+    GCHECK("Capacity rounded up", buffer.capacity(), Size{4});
+
+    for (Integer i = 0; i < 4; ++i) {
+        GCHECK("Push", buffer.tryPush(i), true);
+    }
+    GCHECK("Push when full", buffer.tryPush(4), false);
+    GCHECK("Size", buffer.sizeApprox(), Size{4});
+
+    Integer value{-1};
+    for (Integer i = 0; i < 4; ++i) {
+        GCHECK("Pop", buffer.tryPop(value), true);
+        GCHECK("Pop order", value, i);
+    }
+    GCHECK("Pop when empty", buffer.tryPop(value), false);
+}
+
 } // namespace gbase::test
\ No newline at end of file
@@ -1,4 +1,11 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <thread>
 
 #include "g_basic_types.hpp"
 #include "g_connections.hpp"
@@ -123,6 +130,185 @@ GTEST(GConnectionsTest) {
     GCHECK("number count observers", subject.theCountConnector.connectionCount(), Size{0});
 
     subject.theMessageConnector.notify(&subject, hello);
+
+    G1PConnector<TestSubjectI, Integer> connector;
+    GConnectable first, second, third;
+    std::vector<Integer> received;
+    const auto receiver = [&received](Integer factor) {
+        return [&received, factor](TestSubjectI *, const Integer &value) {
+            received.push_back(factor * value);
+        };
+    };
+    connector.connect(&first, receiver(1));
+    connector.connect(&second, receiver(10));
+    connector.connect(&third, receiver(100));
+    connector.disconnect(&first);
+    GCHECK("Disconnected first", connector.isConnected(&first), false);
+    GCHECK("Still connected", connector.isConnected(&third), true);
+
+    connector.notify(&subject, 1);
+    std::ranges::sort(received);
+    GCHECK("Notified remaining", received, std::vector<Integer>{10, 100});
+
+    received.clear();
+    connector.notify(&subject, &third, 2);
+    GCHECK("Targeted notify", received, std::vector<Integer>{200});
+
+    G0PConnector<TestSubjectI> selfDisconnecting;
+    Integer selfCalls{0};
+    selfDisconnecting.connect(&first, [&](TestSubjectI *) {
+        ++selfCalls;
+        selfDisconnecting.disconnect(&first);
+    });
+    selfDisconnecting.notify(&subject);
+    selfDisconnecting.notify(&subject);
+    GCHECK("Disconnected itself", selfCalls, 1);
+
+    // The other thread waits in disconnect() for the callback, which must still be able to disconnect.
+    struct Racing {
+        G0PConnector<TestSubjectI> connector;
+        GConnectable self, other;
+        std::atomic<bool> notified{false};
+        std::atomic<Integer> finished{0};
+    };
+    const auto racing = std::make_shared<Racing>();
+    racing->connector.connect(&racing->other, [](TestSubjectI *) {});
+    racing->connector.connect(&racing->self, [state = racing.get()](TestSubjectI *) {
+        state->notified = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        state->connector.disconnect(&state->self);
+    });
+    std::thread notifier{[racing] {
+        racing->connector.notify(nullptr);
+        ++racing->finished;
+    }};
+    std::thread disconnector{[racing] {
+        while (!racing->notified.load()) {
+            std::this_thread::yield();
+        }
+        racing->connector.disconnect(&racing->other);
+        ++racing->finished;
+    }};
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{3};
+    while (racing->finished.load() != 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    GCHECK("Disconnected itself while another thread disconnects", racing->finished.load(), 2);
+    if (racing->finished.load() == 2) {
+        notifier.join();
+        disconnector.join();
+    } else {
+        notifier.detach();
+        disconnector.detach();
+    }
+    GCHECK("Both disconnected", racing->connector.connectionCount(), Size{0});
+
+    struct Listener : public GConnectable {
+        std::atomic<bool> disconnected{false};
+        G0PAutoConnection<TestSubjectI> connection;
+    };
+
+    G0PConnector<TestSubjectI> shared;
+    std::vector<Listener> listeners(50);
+    std::atomic<bool> stop{false};
+    std::atomic<Integer> callsAfterDisconnect{0};
+    std::thread emitter{[&] {
+        while (!stop.load()) {
+            shared.notify(&subject);
+        }
+    }};
+    for (auto &listener : listeners) {
+        const auto onNotify = [&](TestSubjectI *) {
+            if (listener.disconnected.load()) {
+                ++callsAfterDisconnect;
+            }
+        };
+        listener.connection = G0PAutoConnection<TestSubjectI>{shared, &listener, onNotify};
+    }
+    for (auto &listener : listeners) {
+        listener.connection.disconnect();
+        listener.disconnected = true;
+    }
+    stop = true;
+    emitter.join();
+
+    GCHECK("No calls after disconnect", callsAfterDisconnect.load(), 0);
+    GCHECK("All disconnected", shared.connectionCount(), Size{0});
+
+    struct LineView : public GConnectable {
+        void onLineChanged(TestSubjectI *subject, const Integer &line, const String &text) {
+            lines.push_back(subject->name() + ":" + std::to_string(line) + ":" + text);
+        }
+
+        std::vector<String> lines;
+        GAutoConnection<TestSubjectI, Integer, String> connection;
+    };
+
+    GSignal<TestSubjectI, Integer, String> lineChanged;
+    LineView boundView, autoView;
+    lineChanged.connect<&LineView::onLineChanged>(&boundView);
+    autoView.connection.connect<&LineView::onLineChanged>(lineChanged, &autoView);
+    lineChanged.notify(&subject, 12, String{"text"});
+    lineChanged.notify(&subject, &autoView, 13, String{"only"});
+    GCHECK("Bound member function", boundView.lines, std::vector<String>{"Subject:12:text"});
+    GCHECK("Auto connection", autoView.lines, (std::vector<String>{"Subject:12:text", "Subject:13:only"}));
+    autoView.connection.disconnect();
+    GCHECK("Remaining connections", lineChanged.connectionCount(), Size{1});
+
+    G1PConnector<TestSubjectI, Integer> samples;
+    std::vector<Size> batchSizes;
+    std::vector<Integer> batchSum;
+    GConnectable batchReceiver, singleReceiver;
+    samples.connectBatch(&batchReceiver, [&](TestSubjectI *, std::span<const Integer> events) {
+        batchSizes.push_back(events.size());
+        batchSum.push_back(std::accumulate(events.begin(), events.end(), 0));
+    });
+    std::vector<Integer> singles;
+    samples.connect(&singleReceiver, [&](TestSubjectI *, const Integer &value) { singles.push_back(value); });
+
+    const std::vector<Integer> events{1, 2, 3, 4};
+    samples.notifyBatch(&subject, events);
+    samples.notify(&subject, 5);
+    samples.notify(&subject, &batchReceiver, 6);
+    GCHECK("Batch sizes", batchSizes, (std::vector<Size>{4, 1, 1}));
+    GCHECK("Batch sums", batchSum, (std::vector<Integer>{10, 5, 6}));
+    GCHECK("Single slot per event", singles, (std::vector<Integer>{1, 2, 3, 4, 5}));
+    GCHECK("Batch connections counted", samples.connectionCount(), Size{2});
+
+    samples.disconnect(&batchReceiver);
+    samples.disconnect(&singleReceiver);
+    GCHECK("Batch connections removed", samples.connectionCount(), Size{0});
+
+    G1PConnector<TestSubjectI, Integer> handles;
+    std::vector<Integer> firstValues, secondValues;
+    const auto firstHandle =
+        handles.connect(&first, [&](TestSubjectI *, const Integer &value) { firstValues.push_back(value); });
+    const auto secondHandle =
+        handles.connect(&first, [&](TestSubjectI *, const Integer &value) { secondValues.push_back(value); });
+    GCHECK("Several connections of one instance", handles.connectionCount(), Size{2});
+    handles.notify(&subject, secondHandle, 1);
+    handles.notify(&subject, &first, 2);
+    GCHECK("Targeted by handle", firstValues, std::vector<Integer>{2});
+    GCHECK("Targeted by instance", secondValues, (std::vector<Integer>{1, 2}));
+
+    handles.disconnect(firstHandle);
+    GCHECK("Stale handle", handles.isConnected(firstHandle), false);
+    GCHECK("Other connection kept", handles.isConnected(secondHandle), true);
+    const auto reused = handles.connect(&second, [](TestSubjectI *, const Integer &) {});
+    GCHECK("Slot reused", reused.index, firstHandle.index);
+    GCHECK("New generation", reused.generation != firstHandle.generation, true);
+    handles.notify(&subject, firstHandle, 3);
+    handles.disconnect(firstHandle);
+    GCHECK("Stale handle ignored", firstValues.size() + handles.connectionCount(), Size{3});
+
+    {
+        G1PAutoConnection<TestSubjectI, Integer> connection{
+            handles, &first, [&](TestSubjectI *, const Integer &value) { firstValues.push_back(value); }};
+        GCHECK("Auto connection handle", handles.isConnected(connection.handle()), true);
+        GCHECK("Added to instance connections", handles.connectionCount(), Size{3});
+    }
+    GCHECK("Only own connection removed", handles.isConnected(&first), true);
+    GCHECK("Remaining after auto disconnect", handles.connectionCount(), Size{2});
 }
 
 } // namespace gbase::test
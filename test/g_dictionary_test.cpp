@@ -1,4 +1,8 @@
+#include <array>
+#include <cstddef>
+#include <memory_resource>
 #include <sstream>
+#include <utility>
 
 #include "g_dictionary.hpp"
 #include "g_exceptions.hpp"
@@ -42,6 +46,21 @@ GTEST(GDictionaryTest) {
 
     auto key = d1.findKeyOfValue(String("eleven"));
     GCHECK("Key of value 1", *key, 11);
+
+    std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    pmr::GDictionary<Integer, Integer> arenaDictionary{&arena};
+    for (Integer i = 0; i < 20; ++i) {
+        arenaDictionary.insert({i, i * i});
+    }
+    GCHECK("Arena dictionary", arenaDictionary[7], 49);
+    GCHECK("Arena dictionary size", arenaDictionary.size(), Size{20});
+    const pmr::GDictionary<Integer, Integer> arenaCopy(arenaDictionary, arenaDictionary.get_allocator());
+    GCHECK("Arena copy", arenaCopy[7], 49);
+    GCHECK("Copy keeps memory resource", arenaCopy.get_allocator().resource(),
+           static_cast<std::pmr::memory_resource *>(&arena));
+    pmr::GDictionary<Integer, Integer> arenaMoved(std::move(arenaDictionary), &arena);
+    GCHECK("Arena move", arenaMoved.size(), Size{20});
 }
 
 } // namespace gbase::test
\ No newline at end of file
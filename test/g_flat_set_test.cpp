@@ -0,0 +1,84 @@
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <sstream>
+
+#include "g_flat_set.hpp"
+#include "g_test_framework.hpp"
+#include "g_vector.hpp"
+
+namespace gbase::test {
+
+GTEST(GFlatSetTest) {
+    GFlatSet v1 = {'D', 'B', 'C', 'A', 'B'};
+    GCHECK("Sorted and unique", v1.size(), Size{4});
+    GCHECK("Contains 1", v1.contains('A'), true);
+    GCHECK("Contains 2", v1.contains('F'), false);
+
+    GFlatSet v2{v1};
+    GCHECK("Copy constructor", v2, v1);
+
+    std::stringstream ss{""};
+    v1.print(ss);
+    const String expectedPrint{"[A, B, C, D]"};
+    GCHECK("Print", ss.str(), expectedPrint);
+
+    GFlatSet toBeExtended{'A', 'C', 'D'};
+    toBeExtended += 'B';
+    GCHECK("Extend 1", toBeExtended, GFlatSet{'A', 'B', 'C', 'D'});
+
+    const GFlatSet extendVector{'F', 'E'};
+    toBeExtended += extendVector;
+    GCHECK("Extend 2", toBeExtended, GFlatSet{'A', 'B', 'C', 'D', 'E', 'F'});
+    toBeExtended += {'F', 'A', 'G'};
+    GCHECK("Extend with duplicates", toBeExtended, GFlatSet{'A', 'B', 'C', 'D', 'E', 'F', 'G'});
+    toBeExtended -= GVector<Char>{'G', 'X', 'A'};
+    GCHECK("Erase range", toBeExtended, GFlatSet{'B', 'C', 'D', 'E', 'F'});
+
+    GCHECK("distance 1", toBeExtended.distance('D'), 2);
+    GCHECK("distance 2", toBeExtended.distance('H'), -1);
+    GCHECK("Subset", GFlatSet{'C', 'E'}.isSubsetOf(toBeExtended), true);
+    GCHECK("Superset", toBeExtended.isSupersetOf(GFlatSet{'C', 'X'}), false);
+
+    const GFlatSet<Char> base{'A', 'B'};
+    const GFlatSet<Char> combined = base + extendVector + 'C' - 'A' - GVector<Char>{'E'};
+    GCHECK("Operator chain", combined, (GFlatSet<Char>{'B', 'C', 'F'}));
+    GCHECK("Left operand unchanged", base, (GFlatSet<Char>{'A', 'B'}));
+
+    GVector<Integer> numbers;
+    for (Integer i = 0; i < 1000; ++i) {
+        numbers += (i * 7919) % 500;
+    }
+    GFlatSet<Integer> bulk{numbers};
+    bulk += GVector<Integer>{-1, 1000, 250};
+    GCHECK("Bulk insert", bulk.size(), Size{502});
+    GCHECK("Bulk sorted", std::ranges::is_sorted(bulk.span()), true);
+    GCHECK("Bulk distance", bulk.distance(250), 251);
+
+    const GFlatSet<Integer> odd{1, 3, 5, 7, 9};
+    GCHECK("Intersect", odd.intersect(bulk), (GFlatSet<Integer>{1, 3, 5, 7, 9}));
+    GCHECK("Intersect small", odd.intersect(GFlatSet<Integer>{1, 2, 3, 4}), (GFlatSet<Integer>{1, 3}));
+    GCHECK("Unite", odd.unite(GFlatSet<Integer>{2, 4}), (GFlatSet<Integer>{1, 2, 3, 4, 5, 7, 9}));
+    GCHECK("Difference", bulk.difference(odd).size(), Size{497});
+    GCHECK("Symmetric difference", odd.symmetricDifference(GFlatSet<Integer>{1, 2}),
+           (GFlatSet<Integer>{2, 3, 5, 7, 9}));
+    GCHECK("Set minus set", odd - GFlatSet<Integer>{3, 4}, (GFlatSet<Integer>{1, 5, 7, 9}));
+    GCHECK("Temporary minus set", (odd + 11) - GFlatSet<Integer>{3, 4}, (GFlatSet<Integer>{1, 5, 7, 9, 11}));
+    GCHECK("Temporary minus many", GFlatSet<Integer>{odd} - bulk, GFlatSet<Integer>{});
+    GFlatSet<String> words{"a", "b", "c", "d"};
+    words -= GFlatSet<String>{"b", "d", "e"};
+    GCHECK("Erase set in place", words, (GFlatSet<String>{"a", "c"}));
+    words -= words;
+    GCHECK("Set minus itself", words.empty(), true);
+
+    std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    pmr::GFlatSet<Integer> arenaSet({3, 1, 2}, &arena);
+    arenaSet += GVector<Integer>{5, 4};
+    const auto arenaResult = arenaSet - 1;
+    GCHECK("Arena set", arenaResult, (pmr::GFlatSet<Integer>{2, 3, 4, 5}));
+    GCHECK("Copy keeps memory resource", arenaResult.get_allocator().resource(),
+           static_cast<std::pmr::memory_resource *>(&arena));
+}
+
+} // namespace gbase::test
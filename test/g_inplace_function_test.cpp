@@ -0,0 +1,56 @@
+#include <array>
+#include <functional>
+#include <memory>
+
+#include "g_inplace_function.hpp"
+#include "g_test_framework.hpp"
+
+namespace gbase::test {
+
+namespace {
+
+Integer negate(Integer value) { return -value; }
+
+} // namespace
+
+GTEST(GInplaceFunctionTest) {
+    GInplaceFunction<Integer(Integer)> empty;
+    GCHECK("Empty function", static_cast<bool>(empty), false);
+
+    GInplaceFunction<Integer(Integer)> twice = [](Integer value) { return 2 * value; };
+    GCHECK("Lambda", twice(4), 8);
+    GCHECK("Lambda inline", twice.isOnHeap(), false);
+
+    GInplaceFunction<Integer(Integer)> pointer = &negate;
+    GCHECK("Function pointer", pointer(4), -4);
+
+    const std::array<Integer, 8> offsets{1, 2, 3, 4, 5, 6, 7, 8};
+    GInplaceFunction<Integer(Integer)> large = [offsets](Integer value) { return value + offsets.back(); };
+    GCHECK("Large lambda", large(1), 9);
+    GCHECK("Large lambda on heap", large.isOnHeap(), true);
+
+    auto copy = large;
+    GCHECK("Copied large lambda", copy(2), 10);
+    auto moved = std::move(copy);
+    GCHECK("Moved large lambda", moved(3), 11);
+    GCHECK("Moved from function", static_cast<bool>(copy), false);
+
+    const auto counter = std::make_shared<Integer>(0);
+    {
+        GInplaceFunction<void()> increment = [counter] { ++*counter; };
+        auto incrementCopy = increment;
+        increment();
+        incrementCopy();
+        GCHECK("Shared state", *counter, 2);
+        GCHECK("Captured copies", counter.use_count(), 3L);
+    }
+    GCHECK("Captures destroyed", counter.use_count(), 1L);
+
+    GInplaceFunction<Integer(Integer)> fromStdFunction = std::function<Integer(Integer)>{};
+    GCHECK("Empty std::function", static_cast<bool>(fromStdFunction), false);
+
+    twice = nullptr;
+    GCHECK("Reset function", static_cast<bool>(twice), false);
+}
+
+} // namespace gbase::test
@@ -0,0 +1,46 @@
+#include <cstdint>
+#include <filesystem>
+
+#include "g_log_binary.hpp"
+#include "g_test_framework.hpp"
+#include "g_vector.hpp"
+
+namespace gbase::test {
+
+GTEST(GLogBinaryTest) {
+    const GPath path = std::filesystem::temp_directory_path() / "g_log_binary_test.glog";
+
+    static const GLogCallSite concatSite{GLogSeverity::Info, GLogLevel::Normal, "file.cpp", "function", 7};
+    static const GLogCallSite formatSite{GLogSeverity::Warning, GLogLevel::Details, "other.cpp", "method", 9};
+    static const GLogCallSite byteSite{GLogSeverity::Info, GLogLevel::Normal, "other.cpp", "method", 11};
+    {
+        GBinaryLogWriter writer{path};
+        writer.write(concatSite, "", "Value: ", 42, ", ", 2.5, ' ', true, " ", GVector{1, 2});
+        writer.write(formatSite, "{:>4}|{:.2f}|{}|{{}}", 7u, 3.14159, String{"text"});
+        writer.write(concatSite, "", "Again");
+        writer.write(byteSite, "{} {} {}", std::uint8_t{65}, static_cast<signed char>(-3), 'A');
+    }
+
+    GBinaryLogReader reader{path};
+
+    const auto first = reader.next();
+    GCHECK("First record", first.has_value(), true);
+    GCHECK("Concatenated text", first->text, String{"Value: 42, 2.5 1 [1, 2]"});
+    GCHECK("Message", first->message(), String{"file.cpp | function | Value: 42, 2.5 1 [1, 2]"});
+    GCHECK("Line", first->line, 7);
+
+    const auto second = reader.next();
+    GCHECK("Formatted text", second->text, String{"   7|3.14|text|{}"});
+    GCHECK("Severity", second->severity, GLogSeverity::Warning);
+    GCHECK("Level", second->level, GLogLevel::Details);
+
+    const auto third = reader.next();
+    GCHECK("Reused call site", third->message(), String{"file.cpp | function | Again"});
+    const auto fourth = reader.next();
+    GCHECK("Byte sized integers", fourth->text, String{"65 -3 A"});
+    GCHECK("End of file", reader.next().has_value(), false);
+
+    std::filesystem::remove(path);
+}
+
+} // namespace gbase::test
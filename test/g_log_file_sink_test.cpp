@@ -0,0 +1,60 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "g_log_file_sink.hpp"
+#include "g_test_framework.hpp"
+
+namespace gbase::test {
+
+namespace {
+
+String readFile(const GPath &path) {
+    std::ifstream file{path, std::ios::binary};
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+} // namespace
+
+GTEST(GLogFileSinkTest) {
+    const GPath directory = std::filesystem::temp_directory_path() / "g_log_file_sink_test";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const GPath basePath = directory / "app";
+
+    {
+        GMappedFileLogSink sink{{.basePath = basePath, .segmentSize = 64, .maxSegments = 2}};
+        GCHECK("First segment", sink.currentSegment(), GPath{directory / "app.000001.log"});
+
+        sink.write({GLogSeverity::Info, {}, "first"});
+        sink.write({GLogSeverity::Warning, "01:02:03:004", "second"});
+        sink.flush();
+        GCHECK("Same segment", sink.currentSegment(), GPath{directory / "app.000001.log"});
+
+        for (Integer i = 0; i < 3; ++i) {
+            sink.write({GLogSeverity::Info, {}, "a message filling the segment"});
+        }
+        sink.sync();
+        GCHECK("Rotated segment", sink.currentSegment(), GPath{directory / "app.000004.log"});
+    }
+
+    GCHECK("Oldest segment removed", std::filesystem::exists(directory / "app.000001.log"), false);
+    GCHECK("Old segment removed", std::filesystem::exists(directory / "app.000002.log"), false);
+    const String record{"INFO: a message filling the segment\n"};
+    GCHECK("Closed segment", readFile(directory / "app.000003.log"), record);
+    GCHECK("Last segment", readFile(directory / "app.000004.log"), record);
+
+    {
+        GMappedFileLogSink sink{{.basePath = basePath}};
+        GCHECK("Continued numbering", sink.currentSegment(), GPath{directory / "app.000005.log"});
+        sink.write({GLogSeverity::Warning, "01:02:03:004", "second"});
+    }
+    GCHECK("Warning record", readFile(directory / "app.000005.log"),
+           String{"01:02:03:004 WARNING: second\n"});
+
+    std::filesystem::remove_all(directory);
+}
+
+} // namespace gbase::test
@@ -0,0 +1,191 @@
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include "g_logger.hpp"
+#include "g_test_framework.hpp"
+#include "g_vector.hpp"
+
+namespace gbase::test {
+
+namespace {
+
+/**
+ * @brief Logs while it is streamed into another log.
+ */
+struct LoggingValue {};
+
+std::ostream &operator<<(std::ostream &s, const LoggingValue &) {
+    GLOG_INFO("inner ", 1);
+    return s << "value";
+}
+
+/**
+ * @brief Counts the written logs with the text "marker", and how many of them had been written at the last
+ * flush.
+ */
+class MarkerSink : public GLogSink {
+  public:
+    void write(const GLogEntry &entry) override { written_ += entry.message == "marker" ? 1 : 0; }
+    void flush() override { flushed_ = written_.load(); }
+
+    Integer flushed() const { return flushed_.load(); }
+
+  private:
+    std::atomic<Integer> written_{0};
+    std::atomic<Integer> flushed_{0};
+};
+
+} // namespace
+
+GTEST(GLoggerTest) {
+    std::stringstream ss{""};
+    {
+        GStreamLogSink sink{ss, false};
+        GAsyncLogWriter writer{sink, 64, GLogOverflowPolicy::Block};
+
+        GVector<std::thread> producers;
+        for (Integer p = 0; p < 4; ++p) {
+            producers.emplace_back([&writer, p] {
+                for (Integer i = 0; i < 100; ++i) {
+                    writer.push({GLogSeverity::Info, {}, concatToString(p, ":", i)});
+                }
+            });
+        }
+        for (auto &producer : producers) {
+            producer.join();
+        }
+
+        writer.flush();
+        GCHECK("Dropped with block policy", writer.droppedCount(), Size{0});
+    }
+
+    Integer lines{0};
+    for (String line; std::getline(ss, line);) {
+        ++lines;
+    }
+    GCHECK("Written lines", lines, 400);
+
+    {
+        MarkerSink sink;
+        GAsyncLogWriter writer{sink, 64, GLogOverflowPolicy::Block};
+        std::atomic<bool> stop{false};
+        std::thread steady{[&] {
+            while (!stop.load()) {
+                writer.push({GLogSeverity::Info, {}, "steady"});
+            }
+        }};
+        for (Integer i = 0; i < 10; ++i) {
+            writer.push({GLogSeverity::Info, {}, "marker"});
+        }
+        writer.flush();
+        GCHECK("Flush with a steady producer", sink.flushed(), 10);
+        stop = true;
+        steady.join();
+    }
+
+    std::stringstream shared{""};
+    {
+        GStreamLogSink sink{shared, false};
+        GVector<std::thread> writers;
+        for (Integer w = 0; w < 4; ++w) {
+            writers.emplace_back([&sink] {
+                for (Integer i = 0; i < 100; ++i) {
+                    sink.write({GLogSeverity::Info, {}, "concurrent line"});
+                }
+            });
+        }
+        for (auto &thread : writers) {
+            thread.join();
+        }
+    }
+    Integer intactLines{0};
+    for (String line; std::getline(shared, line);) {
+        intactLines += line == "INFO: concurrent line" ? 1 : 0;
+    }
+    GCHECK("Concurrent writes keep lines intact", intactLines, 400);
+
+    std::stringstream dropped{""};
+    GStreamLogSink droppedSink{dropped, false};
+    GAsyncLogWriter dropNewest{droppedSink, 2, GLogOverflowPolicy::DropNewest};
+    for (Integer i = 0; i < 1000; ++i) {
+        dropNewest.push({GLogSeverity::Info, {}, concatToString(i)});
+    }
+    dropNewest.flush();
+    GCHECK("Dropped with drop newest policy", dropNewest.droppedCount() > 0, true);
+
+    std::stringstream first{""};
+    std::stringstream second{""};
+    GLogSinkGroup group{{std::make_shared<GStreamLogSink>(first, false),
+                         std::make_shared<GStreamLogSink>(second, false)}};
+    group.write({GLogSeverity::Warning, "00:00:00:000", "file | function | text"});
+    GCHECK("First sink", first.str(), String{"00:00:00:000 WARNING: file | function | text\n"});
+    GCHECK("Second sink", second.str(), first.str());
+
+    GLogBuffer<8> buffer;
+    buffer.append("1234");
+    std::format_to(buffer.inserter(), "{}", 56);
+    GCHECK("Inline buffer", buffer.view(), std::string_view{"123456"});
+    GCHECK("Inline buffer not spilled", buffer.spilled(), false);
+    buffer.append("789");
+    GCHECK("Spilled buffer", buffer.view(), std::string_view{"123456789"});
+    GCHECK("Buffer spilled", buffer.spilled(), true);
+    buffer.clear();
+    GCHECK("Cleared buffer", buffer.view().empty(), true);
+
+    GLogger &logger = GLogger::getInstance();
+    {
+        GLocalLogLevel localLogLevel(GLogger::LogLevel::None, GLogScope::Thread);
+        GCHECK("Thread log level", logger.currentLogLevel(), GLogger::LogLevel::None);
+
+        GLogger::LogLevel otherThreadLevel{GLogger::LogLevel::None};
+        std::thread{[&] { otherThreadLevel = logger.currentLogLevel(); }}.join();
+        GCHECK("Other thread log level", otherThreadLevel, logger.processLogLevel());
+    }
+    GCHECK("Restored thread log level", logger.threadLogLevel().has_value(), false);
+
+    {
+        GLocalLogFilter localLogFilter({"trigger"});
+        std::vector<String> otherThreadFilter;
+        std::thread{[&] { otherThreadFilter = logger.currentFilter(); }}.join();
+        GCHECK("Filter seen by other thread", otherThreadFilter, std::vector<String>{"trigger"});
+
+        GLocalLogFilter localThreadFilter({}, GLogScope::Thread);
+        GCHECK("Thread filter", logger.currentFilter().empty(), true);
+    }
+    GCHECK("Restored filter", logger.currentFilter().empty(), true);
+
+    GLogRateLimiter limiter;
+    GCHECK("Admitted first time", limiter.every(std::chrono::minutes{1}).admitted, true);
+    GCHECK("Suppressed within interval", limiter.every(std::chrono::minutes{1}).admitted, false);
+    GCHECK("Suppressed count", limiter.every(std::chrono::milliseconds{0}).suppressed, Size{1});
+
+    std::stringstream limited{""};
+    const auto limitedSink = std::make_shared<GStreamLogSink>(limited, false);
+    logger.removeSink(logger.consoleSink());
+    logger.addSink(limitedSink);
+    logger.showTimestamp(false);
+    for (Integer i = 0; i < 7; ++i) {
+        GLOG_INFO_EVERY_N(3, "every ", i);
+        GLOG_WARNING_FMT_FIRST_N(2, "first {}", i);
+        GLOG_INFO_EVERY_MS(60'000, "interval ", i);
+    }
+    GLOG_INFO("outer ", LoggingValue{}, " ", 2);
+    logger.removeSink(limitedSink);
+    logger.addSink(logger.consoleSink());
+    logger.showTimestamp(true);
+
+    std::vector<String> texts;
+    for (String line; std::getline(limited, line);) {
+        texts.push_back(line.substr(line.rfind(" | ") + 3));
+    }
+    GCHECK("Rate limited logs", texts,
+           std::vector<String>{"every 0", "first 0", "interval 0", "first 1", "Suppressed 2 similar messages",
+                               "every 3", "Suppressed 2 similar messages", "every 6", "inner 1",
+                               "outer value 2"});
+}
+
+} // namespace gbase::test
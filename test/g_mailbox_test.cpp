@@ -0,0 +1,110 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "g_connections.hpp"
+#include "g_mailbox.hpp"
+#include "g_test_framework.hpp"
+
+namespace gbase::test {
+
+namespace {
+
+struct Sender {
+    G1PConnector<Sender, Integer> valueChanged;
+};
+
+struct Receiver : public GConnectable {
+    void onValue(Sender *, const Integer &value) { values.push_back(value); }
+
+    std::vector<Integer> values;
+};
+
+} // namespace
+
+GTEST(GMailboxTest) {
+    GMailbox mailbox;
+    std::vector<Integer> order;
+    mailbox.post([&order] { order.push_back(1); });
+    mailbox.post([&order] { order.push_back(2); }, GMailbox::Key{&order, nullptr});
+    mailbox.post([&order] { order.push_back(3); }, GMailbox::Key{&order, nullptr});
+    GCHECK("Coalesced pending count", mailbox.pendingCount(), Size{2});
+    GCHECK("Drained count", mailbox.drain(), Size{2});
+    GCHECK("Order kept", order, (std::vector<Integer>{1, 3}));
+    GCHECK("Nothing pending", mailbox.drain(), Size{0});
+
+    Sender sender;
+    Receiver latest;
+    Receiver every;
+    GMailbox latestMailbox;
+    GMailbox everyMailbox;
+    sender.valueChanged.connectQueued(
+        &latest, latestMailbox, [&latest](Sender *s, const Integer &v) { latest.onValue(s, v); },
+        GCoalescing::Latest);
+    G1PAutoConnection<Sender, Integer> connection;
+    connection.connectQueued(sender.valueChanged, &every, everyMailbox, &Receiver::onValue);
+
+    for (Integer i = 1; i <= 5; ++i) {
+        sender.valueChanged.notify(&sender, i);
+    }
+    GCHECK("Not called before drain", latest.values.empty() && every.values.empty(), true);
+    latestMailbox.drain();
+    everyMailbox.drain();
+    GCHECK("Only latest value", latest.values, (std::vector<Integer>{5}));
+    GCHECK("Every value", every.values, (std::vector<Integer>{1, 2, 3, 4, 5}));
+
+    connection.disconnect();
+    everyMailbox.close();
+    sender.valueChanged.notify(&sender, 6);
+    GCHECK("Closed mailbox discards", everyMailbox.pendingCount(), Size{0});
+    sender.valueChanged.disconnect(&latest);
+
+    GMailboxPool pool{2};
+    GCHECK("Pool threads", pool.threadCount(), Size{2});
+    std::atomic<Integer> sum{0};
+    std::atomic<bool> overlapped{false};
+    std::atomic<Integer> running{0};
+    {
+        GMailbox pooled{pool};
+        constexpr Integer Posts = 1000;
+        for (Integer i = 1; i <= Posts; ++i) {
+            pooled.post([&, i] {
+                if (running.fetch_add(1) != 0) {
+                    overlapped = true;
+                }
+                sum += i;
+                running.fetch_sub(1);
+            });
+        }
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+        while (sum.load() != Posts * (Posts + 1) / 2 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    }
+    GCHECK("Pool ran all tasks", sum.load(), 500500);
+    GCHECK("Tasks of a mailbox never overlap", overlapped.load(), false);
+
+    // A busy mailbox is closed and destroyed while tasks are still posted, so no worker may queue it again.
+    std::atomic<Integer> busyRuns{0};
+    for (Integer round = 0; round < 200; ++round) {
+        auto busy = std::make_unique<GMailbox>(pool);
+        std::atomic<bool> stop{false};
+        std::thread poster{[&] {
+            while (!stop.load()) {
+                busy->post([&busyRuns] { ++busyRuns; });
+            }
+        }};
+        while (busyRuns.load() <= round) {
+            std::this_thread::yield();
+        }
+        busy->close();
+        stop = true;
+        poster.join();
+        busy.reset();
+    }
+    GCHECK("Busy mailboxes ran tasks", busyRuns.load() >= 200, true);
+}
+
+} // namespace gbase::test
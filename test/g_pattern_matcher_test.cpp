@@ -0,0 +1,26 @@
+#include "g_pattern_matcher.hpp"
+#include "g_test_framework.hpp"
+
+namespace gbase::test {
+
+GTEST(GPatternMatcherTest) {
+    const GPatternMatcher matcher{"he", "she", "his", "hers"};
+
+    GCHECK("Match 1", matcher.matchesAny("ushers"), true);
+    GCHECK("Match 2", matcher.matchesAny("this"), true);
+    GCHECK("Match at end", matcher.matchesAny("aaash"), false);
+    GCHECK("No match", matcher.matchesAny("xyz"), false);
+    GCHECK("Empty text", matcher.matchesAny(""), false);
+    GCHECK("Split text", matcher.matchesAny({"ab", "s", "h", "e"}), true);
+
+    const GPatternMatcher overlapping{"abcd", "bc"};
+    GCHECK("Pattern inside longer pattern", overlapping.matchesAny("xabcx"), true);
+
+    const GPatternMatcher none;
+    GCHECK("No patterns", none.matchesAny("anything"), false);
+
+    const GPatternMatcher emptyPattern{""};
+    GCHECK("Empty pattern", emptyPattern.matchesAny("anything"), true);
+}
+
+} // namespace gbase::test
@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "g_search.hpp"
+#include "g_test_framework.hpp"
+
+namespace gbase::test {
+
+namespace {
+
+/**
+ * @brief Compares the searches with std algorithms for every start offset of the values, so that both the
+ * register loops and the scalar tails are covered.
+ */
+template <typename Type> bool searchesLikeStd(const std::vector<Type> &all, const Type &needle) {
+    for (Size offset = 0; offset < all.size(); ++offset) {
+        const std::span<const Type> values = std::span<const Type>{all}.subspan(offset);
+
+        const auto it = std::ranges::find(values, needle);
+        const std::optional<Size> expectedIndex =
+            it != values.end() ? std::optional<Size>{static_cast<Size>(it - values.begin())} : std::nullopt;
+        std::vector<Size> expectedIndices;
+        for (Size i = 0; i < values.size(); ++i) {
+            if (values[i] == needle) {
+                expectedIndices.push_back(i);
+            }
+        }
+
+        std::vector<Size> indices;
+        forEachIndexOf(values, needle, [&indices](Size index) { indices.push_back(index); });
+        if (findValue(values, needle) != expectedIndex || indices != expectedIndices ||
+            countValue(values, needle) != expectedIndices.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Type> std::vector<Type> pattern(Size count) {
+    std::vector<Type> values(count);
+    for (Size i = 0; i < count; ++i) {
+        values[i] = static_cast<Type>((i * 7) % 11);
+    }
+    return values;
+}
+
+} // namespace
+
+GTEST(GSearchTest) {
+    GCHECK("Chars", searchesLikeStd(pattern<Char>(100), Char{3}), true);
+    GCHECK("16 bit integers", searchesLikeStd(pattern<std::int16_t>(100), std::int16_t{3}), true);
+    GCHECK("Integers", searchesLikeStd(pattern<Integer>(100), 3), true);
+    GCHECK("64 bit integers", searchesLikeStd(pattern<std::int64_t>(100), std::int64_t{3}), true);
+    GCHECK("Floats", searchesLikeStd(pattern<float>(100), 3.0F), true);
+    GCHECK("Doubles", searchesLikeStd(pattern<double>(100), 3.0), true);
+    GCHECK("Strings", searchesLikeStd(std::vector<String>{"a", "b", "a", "c"}, String{"a"}), true);
+    GCHECK("Missing", searchesLikeStd(pattern<Integer>(100), 42), true);
+
+    // Only the upper 32 bits differ, which SSE2 compares separately from the lower bits.
+    const std::vector<std::int64_t> wide{std::int64_t{1} << 32, 1, (std::int64_t{1} << 32) + 1, 1};
+    GCHECK("64 bit halves", findValue(std::span{wide}, std::int64_t{1}).value_or(0), Size{1});
+    GCHECK("64 bit count", countValue(std::span{wide}, std::int64_t{1}), Size{2});
+
+    std::vector<double> doubles(40, 1.0);
+    doubles[33] = -0.0;
+    doubles[37] = std::numeric_limits<double>::quiet_NaN();
+    const std::span<const double> doubleSpan{doubles};
+    GCHECK("Negative zero equals zero", findValue(doubleSpan, 0.0).value_or(0), Size{33});
+    GCHECK("NaN never matches", findValue(doubleSpan, std::numeric_limits<double>::quiet_NaN()).has_value(),
+           false);
+
+    const std::vector<Integer> values = pattern<Integer>(100);
+    const std::vector<Integer> few{42, 9, 5};
+    std::vector<Integer> many{100, 200, 300, 400, 500, 600, 700, 800, 900};
+    GCHECK("First of few", findFirstOf<Integer>(values, few).value_or(0), Size{6});
+    GCHECK("First of many", findFirstOf<Integer>(values, many).has_value(), false);
+    many.push_back(10);
+    GCHECK("First of many found", findFirstOf<Integer>(values, many).value_or(0), Size{3});
+    GCHECK("First of none", findFirstOf<Integer>(values, {}).has_value(), false);
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<double> withNaN{nan, 5.0};
+    const std::vector<double> twoCandidates{nan, 5.0};
+    const std::vector<double> nineCandidates{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, nan};
+    GCHECK("NaN not first of few", findFirstOf<double>(withNaN, twoCandidates).value_or(0), Size{1});
+    GCHECK("NaN not first of many", findFirstOf<double>(withNaN, nineCandidates).value_or(0), Size{1});
+
+    std::vector<Integer> tail(21);
+    std::iota(tail.begin(), tail.end(), 1);
+    const std::vector<Integer> last{42, 21};
+    GCHECK("First of in tail", findFirstOf<Integer>(tail, last).value_or(0), Size{20});
+}
+
+} // namespace gbase::test
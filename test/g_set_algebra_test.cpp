@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "g_exceptions.hpp"
+#include "g_set_algebra.hpp"
+#include "g_test_framework.hpp"
+
+namespace gbase::test {
+
+namespace {
+
+/**
+ * @brief Gives sorted values without duplicates, drawn from [low, low + range), so that two sets overlap.
+ */
+template <typename Type> std::vector<Type> randomSet(Size count, Integer low, Integer range, Unsigned seed) {
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<Integer> distribution{low, low + range - 1};
+    std::vector<Type> values(count);
+    std::ranges::generate(values, [&] { return static_cast<Type>(distribution(generator)); });
+    std::ranges::sort(values);
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+}
+
+template <typename Type>
+bool intersectsLikeStd(const std::vector<Type> &first, const std::vector<Type> &second) {
+    std::vector<Type> expected;
+    std::ranges::set_intersection(first, second, std::back_inserter(expected));
+    std::vector<Type> output(std::min(first.size(), second.size()));
+    output.resize(intersectSorted(first, second, std::span{output}));
+    return output == expected;
+}
+
+} // namespace
+
+GTEST(GSetAlgebraTest) {
+    const std::vector<Integer> first{1, 3, 5, 7, 9, 11, 13};
+    const std::vector<Integer> second{3, 4, 5, 6, 13, 20};
+    std::vector<Integer> output(first.size() + second.size());
+    const std::span<Integer> buffer{output};
+    const auto written = [&output](Size count) {
+        return std::vector<Integer>(output.begin(), output.begin() + static_cast<std::ptrdiff_t>(count));
+    };
+
+    GCHECK("Intersect", written(intersectSorted(first, second, buffer)), (std::vector<Integer>{3, 5, 13}));
+    GCHECK("Unite", written(uniteSorted(first, second, buffer)),
+           (std::vector<Integer>{1, 3, 4, 5, 6, 7, 9, 11, 13, 20}));
+    GCHECK("Difference", written(differenceSorted(first, second, buffer)),
+           (std::vector<Integer>{1, 7, 9, 11}));
+    GCHECK("Symmetric difference", written(symmetricDifferenceSorted(first, second, buffer)),
+           (std::vector<Integer>{1, 4, 6, 7, 9, 11, 20}));
+    GCHECK("Intersect empty", intersectSorted(first, std::vector<Integer>{}, buffer), Size{0});
+
+    bool thrown{false};
+    try {
+        uniteSorted(first, second, buffer.first(first.size()));
+    } catch (const GInvalidArgument &) {
+        thrown = true;
+    }
+    GCHECK("Output too small", thrown, true);
+
+    GCHECK("Dense",
+           intersectsLikeStd(randomSet<Integer>(1000, 0, 1500, 1), randomSet<Integer>(1000, 0, 1500, 2)),
+           true);
+    GCHECK("Sparse", intersectsLikeStd(randomSet<Integer>(1000, -50'000, 100'000, 3),
+                                       randomSet<Integer>(5000, -50'000, 100'000, 4)),
+           true);
+    GCHECK("Disjoint",
+           intersectsLikeStd(randomSet<Integer>(100, 0, 500, 5), randomSet<Integer>(100, 500, 500, 6)),
+           true);
+    GCHECK("Unsigned", intersectsLikeStd(randomSet<std::uint32_t>(777, 0, 1000, 7),
+                                         randomSet<std::uint32_t>(333, 0, 1000, 8)),
+           true);
+    GCHECK("64 bit", intersectsLikeStd(randomSet<std::int64_t>(500, 0, 800, 9),
+                                       randomSet<std::int64_t>(500, 0, 800, 10)),
+           true);
+
+    const std::vector<Integer> all = randomSet<Integer>(100, 0, 100, 11);
+    GCHECK("Identical", intersectsLikeStd(all, all), true);
+    for (Size count = 0; count < 12; ++count) {
+        const std::vector<Integer> head(all.begin(), all.begin() + static_cast<std::ptrdiff_t>(count));
+        GCHECK("Block tails", intersectsLikeStd(head, all) && intersectsLikeStd(all, head), true);
+    }
+}
+
+} // namespace gbase::test
@@ -1,7 +1,11 @@
+#include <array>
+#include <cstddef>
+#include <memory_resource>
 #include <sstream>
 
 #include "g_set.hpp"
 #include "g_test_framework.hpp"
+#include "g_vector.hpp"
 
 namespace gbase::test {
 
@@ -32,6 +36,37 @@ GTEST(GSetTest) {
 
     GCHECK("distance 1", toBeExtended.distance('D'), 3);
     GCHECK("distance 1", toBeExtended.distance('H'), -1);
+
+    const GSet<Char> base{'A', 'B'};
+    const GSet<Char> combined = base + extendVector + 'C' - 'A' - GVector<Char>{'E'};
+    GCHECK("Operator chain", combined, (GSet<Char>{'B', 'C', 'F'}));
+    GCHECK("Left operand unchanged", base, (GSet<Char>{'A', 'B'}));
+
+    const GSet<Integer> odd{1, 3, 5, 7, 9};
+    const GSet<Integer> small{1, 2, 3, 4};
+    GCHECK("Intersect", odd.intersect(small), (GSet<Integer>{1, 3}));
+    GCHECK("Unite", odd.unite(small), (GSet<Integer>{1, 2, 3, 4, 5, 7, 9}));
+    GCHECK("Difference", odd.difference(small), (GSet<Integer>{5, 7, 9}));
+    GCHECK("Symmetric difference", odd.symmetricDifference(small), (GSet<Integer>{2, 4, 5, 7, 9}));
+    GCHECK("Set minus set", odd - small, (GSet<Integer>{5, 7, 9}));
+    GCHECK("Temporary minus set", (odd + 11) - small, (GSet<Integer>{5, 7, 9, 11}));
+    GSet<Integer> many;
+    for (Integer i = 0; i < 100; ++i) {
+        many += i;
+    }
+    GCHECK("Temporary minus few", (GSet<Integer>{many} - GSet<Integer>{0, 50, 99}).size(), Size{97});
+    GCHECK("Temporary minus many", GSet<Integer>{odd} - many, GSet<Integer>{});
+    many -= many;
+    GCHECK("Set minus itself", many.empty(), true);
+
+    std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    pmr::GSet<Integer> arenaSet({3, 1, 2}, &arena);
+    arenaSet += GVector<Integer>{5, 4};
+    const auto arenaResult = arenaSet - 1;
+    GCHECK("Arena set", arenaResult, (pmr::GSet<Integer>{2, 3, 4, 5}));
+    GCHECK("Copy keeps memory resource", arenaResult.get_allocator().resource(),
+           static_cast<std::pmr::memory_resource *>(&arena));
 }
 
 } // namespace gbase::test
\ No newline at end of file
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <memory>
+#include <sstream>
+
+#include "g_exceptions.hpp"
+#include "g_small_vector.hpp"
+#include "g_test_framework.hpp"
+#include "g_vector.hpp"
+
+namespace gbase::test {
+
+namespace {
+
+/**
+ * @brief Throws from its copy or move constructor when copiesLeft or movesLeft runs out, and counts its
+ * live instances.
+ */
+struct Fragile {
+    static inline Integer copiesLeft{0};
+    static inline Integer movesLeft{0};
+    static inline Integer alive{0};
+    bool movedFrom{false};
+
+    Fragile() { ++alive; }
+    Fragile(const Fragile &) {
+        if (copiesLeft-- == 0) {
+            throw GRuntimeError("Copy failed.");
+        }
+        ++alive;
+    }
+    Fragile(Fragile &&other) {
+        if (movesLeft-- == 0) {
+            throw GRuntimeError("Move failed.");
+        }
+        other.movedFrom = true;
+        ++alive;
+    }
+    Fragile &operator=(const Fragile &) = default;
+    ~Fragile() { --alive; }
+};
+
+} // namespace
+
+GTEST(GSmallVectorTest) {
+    GSmallVector<Char, 4> v1 = {'A', 'B', 'C', 'D'};
+    GCHECK("Initalizer list 1", v1.size(), Size{4});
+    GCHECK("Initalizer list 2", v1[0], 'A');
+    GCHECK("Initalizer list 3", v1[3], 'D');
+    GCHECK("Inline storage", v1.isInline(), true);
+
+    GSmallVector v2{v1};
+    v2[1] = 'G';
+    GCHECK("Copy constructor", v2, (GSmallVector<Char, 4>{'A', 'G', 'C', 'D'}));
+    GCHECK("Copy unchanged", v1[1], 'B');
+
+    bool thrown{false};
+    try {
+        v1.at(4);
+    } catch (const GOutOfRange &) {
+        thrown = true;
+    }
+    GCHECK("Checked at()", thrown, true);
+    GCHECK("Span", v1.span().size(), Size{4});
+    GCHECK("Unchecked access", v1.uncheckedAt(2), 'C');
+
+    std::stringstream ss{""};
+    v1.print(ss);
+    GCHECK("Print", ss.str(), String{"[A, B, C, D]"});
+
+    v1 += 'E';
+    GCHECK("Spilled to heap", v1.isInline(), false);
+    GCHECK("Elements kept", v1, (GSmallVector<Char, 4>{'A', 'B', 'C', 'D', 'E'}));
+    GCHECK("Find", v1.find('E').value_or(0), Size{4});
+    GCHECK("Find missing", v1.find('X').has_value(), false);
+    GCHECK("Count", v1.count('A'), Size{1});
+
+    const GVector<Char> extendVector{'F', 'G'};
+    v1 += extendVector;
+    v1 += {'H'};
+    GCHECK("Extend", v1, (GSmallVector<Char, 4>{'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H'}));
+    GCHECK("Operator+", v2 + 'X', (GSmallVector<Char, 4>{'A', 'G', 'C', 'D', 'X'}));
+
+    GSmallVector<Char, 4> moved{std::move(v1)};
+    GCHECK("Moved heap buffer", moved.size(), Size{8});
+    GCHECK("Moved from is empty", v1.empty(), true);
+
+    GSmallVector<Char, 4> rotateVector{'A', 'B', 'C', 'D'};
+    rotateVector.rotate(+1);
+    GCHECK("Rotate right", rotateVector, (GSmallVector<Char, 4>{'D', 'A', 'B', 'C'}));
+    rotateVector.rotate(-2);
+    GCHECK("Rotate left", rotateVector, (GSmallVector<Char, 4>{'B', 'C', 'D', 'A'}));
+
+    const GSmallVector<Char, 4> unsorted{'B', 'A', 'D', 'C'};
+    GCHECK("Const sort", unsorted.sort(), (GSmallVector<Char, 4>{'A', 'B', 'C', 'D'}));
+    GCHECK("Descending sort", unsorted.sort(std::ranges::greater{}),
+           (GSmallVector<Char, 4>{'D', 'C', 'B', 'A'}));
+
+    GSmallVector<Integer, 2> edited{1, 2, 3};
+    edited.insert(edited.begin() + 1, 9);
+    edited.erase(edited.begin());
+    edited.popBack();
+    GCHECK("Insert and erase", edited, (GSmallVector<Integer, 2>{9, 2}));
+    edited.pushBack(edited[0]);
+    GCHECK("Push back own element", edited.back(), 9);
+
+    GSmallVector<String, 2> doubled{"a", "b"};
+    doubled += doubled;
+    GCHECK("Extend by itself to the heap", doubled, (GSmallVector<String, 2>{"a", "b", "a", "b"}));
+    doubled.extend(doubled);
+    GCHECK("Extend by itself on the heap", doubled.size() == 8 && doubled[7] == "b", true);
+    doubled.insert(doubled.begin(), doubled.begin() + 6, doubled.end());
+    GCHECK("Insert own elements", doubled.size() == 10 && doubled[0] == "a" && doubled[1] == "b", true);
+
+    GSmallVector<std::shared_ptr<Integer>, 2> owners;
+    const auto shared = std::make_shared<Integer>(1);
+    for (Integer i = 0; i < 5; ++i) {
+        owners.pushBack(shared);
+    }
+    owners.resize(1);
+    GCHECK("Elements destroyed", shared.use_count(), 2L);
+    owners = {};
+    GCHECK("Cleared", shared.use_count(), 1L);
+
+    {
+        GSmallVector<Fragile, 2> fragile(5);
+        Fragile::copiesLeft = 3;
+        bool copyThrown{false};
+        try {
+            GSmallVector<Fragile, 2> copy{fragile};
+        } catch (const GRuntimeError &) {
+            copyThrown = true;
+        }
+        GCHECK("Throwing copy", copyThrown, true);
+        GCHECK("Throwing copy destroys copies", Fragile::alive, 5);
+
+        Fragile::copiesLeft = 2;
+        Fragile::movesLeft = 2;
+        bool relocateThrown{false};
+        try {
+            fragile.reserve(10);
+        } catch (const GRuntimeError &) {
+            relocateThrown = true;
+        }
+        GCHECK("Throwing relocation", relocateThrown, true);
+        GCHECK("Throwing relocation keeps elements", fragile.size() == 5 && fragile.capacity() == 5, true);
+        GCHECK("Throwing relocation destroys copied elements", Fragile::alive, 5);
+        GCHECK("Throwing relocation moves nothing",
+               std::ranges::none_of(fragile, [](const Fragile &f) { return f.movedFrom; }), true);
+    }
+    GCHECK("All destroyed", Fragile::alive, 0);
+}
+
+} // namespace gbase::test
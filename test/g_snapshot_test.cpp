@@ -0,0 +1,80 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "g_snapshot.hpp"
+#include "g_test_framework.hpp"
+
+namespace gbase::test {
+
+GTEST(GSnapshotTest) {
+    GSnapshotCell<std::vector<Integer>> cell;
+    cell.update([](auto &values) { values.push_back(1); });
+
+    {
+        const auto snapshot = cell.read();
+        cell.update([](auto &values) { values.push_back(2); });
+        GCHECK("Snapshot unchanged by own update", snapshot->size(), Size{1});
+        GCHECK("New value", cell.read()->size(), Size{2});
+    }
+
+    // The writer waits for the reading thread, which updates before its snapshot is released.
+    struct Nested {
+        GSnapshotCell<std::vector<Integer>> cell;
+        std::atomic<bool> reading{false};
+        std::atomic<Integer> finished{0};
+    };
+    const auto nested = std::make_shared<Nested>();
+    std::thread nestedReader{[nested] {
+        const auto snapshot = nested->cell.read();
+        nested->reading = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        nested->cell.update([](auto &values) { values.push_back(1); });
+        ++nested->finished;
+    }};
+    std::thread writer{[nested] {
+        while (!nested->reading.load()) {
+            std::this_thread::yield();
+        }
+        nested->cell.update([](auto &values) { values.push_back(2); });
+        ++nested->finished;
+    }};
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{3};
+    while (nested->finished.load() != 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    GCHECK("Update while another writer waits", nested->finished.load(), 2);
+    if (nested->finished.load() == 2) {
+        nestedReader.join();
+        writer.join();
+        GCHECK("Both updates", nested->cell.read()->size(), Size{2});
+    } else {
+        nestedReader.detach();
+        writer.detach();
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<Integer> inconsistent{0};
+    std::thread reader{[&] {
+        while (!stop.load()) {
+            const auto snapshot = cell.read();
+            for (Size i = 0; i < snapshot->size(); ++i) {
+                if ((*snapshot)[i] != static_cast<Integer>(i) + 1) {
+                    ++inconsistent;
+                }
+            }
+        }
+    }};
+    for (Integer i = 3; i < 200; ++i) {
+        cell.update([i](auto &values) { values.push_back(i); });
+    }
+    stop = true;
+    reader.join();
+
+    GCHECK("Consistent snapshots", inconsistent.load(), 0);
+    GCHECK("Final value", cell.read()->size(), Size{199});
+}
+
+} // namespace gbase::test
@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "g_sort.hpp"
+#include "g_test_framework.hpp"
+
+namespace gbase::test {
+
+namespace {
+
+template <typename Type, typename Distribution>
+std::vector<Type> randomValues(Size count, Distribution distribution) {
+    std::mt19937_64 generator{42};
+    std::vector<Type> values(count);
+    std::ranges::generate(values, [&] { return static_cast<Type>(distribution(generator)); });
+    return values;
+}
+
+template <typename Type> bool sortsLikeStdSort(std::vector<Type> values) {
+    std::vector<Type> expected{values};
+    std::ranges::sort(expected);
+    radixSort(std::span<Type>{values});
+    return values == expected;
+}
+
+} // namespace
+
+GTEST(GSortTest) {
+    std::vector<Integer> small{3, -1, 2, -7, 0};
+    radixSort(std::span<Integer>{small});
+    GCHECK("Below threshold", small, (std::vector<Integer>{-7, -1, 0, 2, 3}));
+
+    using std::int64_t;
+    using std::uint8_t;
+    using IntegerDistribution = std::uniform_int_distribution<Integer>;
+    const auto sorts = [](const auto &values) { return sortsLikeStdSort(values); };
+    GCHECK("Integers", sorts(randomValues<Integer>(10'000, IntegerDistribution{})), true);
+    GCHECK("Small range", sorts(randomValues<Integer>(10'000, IntegerDistribution{-50, 50})), true);
+    GCHECK("Bytes", sorts(randomValues<uint8_t>(1000, IntegerDistribution{0, 255})), true);
+    GCHECK("64 bit integers", sorts(randomValues<int64_t>(5000, std::uniform_int_distribution<int64_t>{})),
+           true);
+    GCHECK("Unsigned", sorts(randomValues<Unsigned>(5000, std::uniform_int_distribution<Unsigned>{})), true);
+    GCHECK("Doubles", sorts(randomValues<double>(10'000, std::uniform_real_distribution<double>{-1e6, 1e6})),
+           true);
+    GCHECK("Floats", sorts(randomValues<float>(10'000, std::normal_distribution<float>{0, 100})), true);
+
+    std::vector<double> limits(RadixSortThreshold, 0.5);
+    limits[3] = -std::numeric_limits<double>::infinity();
+    limits[7] = std::numeric_limits<double>::infinity();
+    limits[9] = std::numeric_limits<double>::lowest();
+    limits[11] = -0.25;
+    radixSort(std::span<double>{limits});
+    GCHECK("Negative infinity first", limits.front(), -std::numeric_limits<double>::infinity());
+    GCHECK("Lowest second", limits[1], std::numeric_limits<double>::lowest());
+    GCHECK("Negative fraction third", limits[2], -0.25);
+    GCHECK("Infinity last", limits.back(), std::numeric_limits<double>::infinity());
+
+    GCHECK("Radix sortable int", RadixSortable<Integer>, true);
+    GCHECK("Bool not radix sortable", RadixSortable<bool>, false);
+    GCHECK("Strings not radix sortable", RadixSortable<String>, false);
+}
+
+} // namespace gbase::test
@@ -1,4 +1,6 @@
+#include <chrono>
 #include <iostream>
+#include <thread>
 
 #include "g_logger.hpp"
 #include "g_test_framework.hpp"
@@ -14,6 +16,31 @@ GTEST(GTimeTest) {
 
     GUTCTime now = GUTCTime::now();
     GLOG_DETAILS("Time: ", now.timeOfDay().toString());
+
+    using std::chrono::milliseconds;
+    const auto render = [](milliseconds sinceEpoch) {
+        const auto text = GTimestampCache::render(sinceEpoch);
+        return String{text.data(), text.size()};
+    };
+    GCHECK("Midnight", render(milliseconds{0}), String{"00:00:00:000"});
+    const milliseconds afternoon{((13 * 60 + 45) * 60 + 7) * 1000 + 42};
+    GCHECK("Time of day", render(afternoon), String{"13:45:07:042"});
+    GCHECK("Next day", render(milliseconds{86'400'000 + 1}), String{"00:00:00:001"});
+    const auto sinceEpoch = std::chrono::duration_cast<milliseconds>(now.timeSinceEpoch());
+    GCHECK("Same text as GTimeOfDay", render(sinceEpoch), now.timeOfDay().toString());
+
+    const std::string_view first = GTimestampCache::now();
+    GCHECK("Timestamp length", first.size(), GTimestampCache::Length);
+    GCHECK("Timestamp separator", first[8], ':');
+    GCHECK("Same thread buffer", GTimestampCache::now().data(), first.data());
+
+    GTimestampCache::startTicker();
+    GCHECK("Ticker running", GTimestampCache::isTickerRunning(), true);
+    std::this_thread::sleep_for(milliseconds{5});
+    const String ticked{GTimestampCache::now()};
+    GTimestampCache::stopTicker();
+    GCHECK("Ticker stopped", GTimestampCache::isTickerRunning(), false);
+    GCHECK("Ticker timestamp", ticked.size(), GTimestampCache::Length);
 }
 
 } // namespace gbase::test
\ No newline at end of file
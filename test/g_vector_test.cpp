@@ -1,5 +1,11 @@
+#include <array>
+#include <cstddef>
+#include <execution>
+#include <memory_resource>
 #include <sstream>
+#include <utility>
 
+#include "g_exceptions.hpp"
 #include "g_test_framework.hpp"
 #include "g_vector.hpp"
 
@@ -19,6 +25,20 @@ GTEST(GVectorTest) {
     v2[1] = 'G';
     GCHECK("Operator[] asigment", v2[1], 'G');
 
+    v2.uncheckedAt(2) = 'H';
+    GCHECK("Unchecked access", v2.uncheckedAt(2), 'H');
+    GCHECK("Span", v2.span().size(), Size{4});
+    GCHECK("Span elements", v2.span()[2], 'H');
+    if constexpr (CheckedAccess) {
+        bool thrown{false};
+        try {
+            v2[4] = 'X';
+        } catch (const GOutOfRange &) {
+            thrown = true;
+        }
+        GCHECK("Checked operator[]", thrown, true);
+    }
+
     std::stringstream ss{""};
     v1.print(ss);
     const String expectedPrint{"[A, B, C, D]"};
@@ -32,6 +52,32 @@ GTEST(GVectorTest) {
     GVector unsorted = {'B', 'A', 'D', 'C'};
     unsorted.sort();
     GCHECK("Mutable sort", unsorted, expectedSorted);
+    unsorted.sort([](Char a, Char b) { return a > b; });
+    GCHECK("Comparator sort", unsorted, (GVector{'D', 'C', 'B', 'A'}));
+    unsorted.sort(std::execution::par, std::ranges::less{});
+    GCHECK("Parallel sort", unsorted, expectedSorted);
+    unsorted = {'C', 'D', 'A', 'B'};
+    unsorted.sort(std::execution::par);
+    GCHECK("Parallel sort with default comparator", unsorted, expectedSorted);
+
+    GVector<Integer> numbers;
+    for (Integer i = 0; i < 1000; ++i) {
+        numbers += (i * 7919) % 1000 - 500;
+    }
+    numbers.sort();
+    GCHECK("Radix sort", std::ranges::is_sorted(numbers) && numbers.front() == -500, true);
+    GCHECK("Descending sort", std::as_const(numbers).sort(std::ranges::greater{}).front(), 499);
+
+    GVector<Integer> haystack;
+    for (Integer i = 0; i < 100; ++i) {
+        haystack += i % 10;
+    }
+    GCHECK("Find", haystack.find(7).value_or(0), Size{7});
+    GCHECK("Find missing", haystack.find(10).has_value(), false);
+    GCHECK("Find all", haystack.findAll(3), (GVector<Size>{3, 13, 23, 33, 43, 53, 63, 73, 83, 93}));
+    GCHECK("Count", haystack.count(9), Size{10});
+    GCHECK("Find first of", haystack.findFirstOf(std::array{8, 5}).value_or(0), Size{5});
+    GCHECK("Find string", (GVector<String>{"a", "b"}).find("b").value_or(0), Size{1});
 
     GVector toBeExtended{'B', 'A', 'D', 'C'};
     toBeExtended += 'D';
@@ -41,6 +87,18 @@ GTEST(GVectorTest) {
     toBeExtended += extendVector;
     GCHECK("Extend 2", toBeExtended, GVector{'B', 'A', 'D', 'C', 'D', 'E', 'F'});
 
+    const GVector<Char> first{'A', 'B'};
+    const GVector<Char> concatenated = first + extendVector + 'G' + std::initializer_list<Char>{'H', 'I'};
+    GCHECK("Concatenation", concatenated, (GVector<Char>{'A', 'B', 'E', 'F', 'G', 'H', 'I'}));
+    GCHECK("Left operand unchanged", first, (GVector<Char>{'A', 'B'}));
+    GVector<Char> temporary{'X'};
+    temporary.reserve(8);
+    const Char *storage = temporary.data();
+    const GVector<Char> reused = std::move(temporary) + 'Y' + first;
+    GCHECK("Rvalue operand reused", static_cast<const void *>(reused.data()),
+           static_cast<const void *>(storage));
+    GCHECK("Rvalue result", reused, (GVector<Char>{'X', 'Y', 'A', 'B'}));
+
     GVector rotateVector{'A', 'B', 'C', 'D'};
     rotateVector.rotate(+1);
     GCHECK("Rotate right", rotateVector, GVector{'D', 'A', 'B', 'C'});
@@ -61,6 +119,16 @@ GTEST(GVectorTest) {
     GCHECK("Rotate +2", rotateVectorInt, GVector{5, 9, 2});
     rotateVectorInt.rotate(+1);
     GCHECK("Rotate +3", rotateVectorInt, GVector{2, 5, 9});
+
+    std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    pmr::GVector<Integer> arenaVector({1, 2, 3}, &arena);
+    arenaVector += GVector<Integer>{4, 5};
+    const auto arenaSum = arenaVector + 6;
+    GCHECK("Arena vector", arenaSum, (pmr::GVector<Integer>{1, 2, 3, 4, 5, 6}));
+    GCHECK("Copy keeps memory resource", arenaSum.get_allocator().resource(),
+           static_cast<std::pmr::memory_resource *>(&arena));
+
 }
 
 } // namespace gbase::test
\ No newline at end of file
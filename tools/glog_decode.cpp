@@ -0,0 +1,51 @@
+#include <chrono>
+#include <iostream>
+#include <string_view>
+
+#include "g_exceptions.hpp"
+#include "g_log_binary.hpp"
+#include "g_log_record.hpp"
+#include "g_time.hpp"
+
+/**
+ * Decodes a binary log file written by gbase::GBinaryLogWriter into the text layout of gbase::GLogger.
+ *
+ * Usage: glog_decode [--no-color] <file>
+ */
+int main(int argc, char *argv[]) {
+    bool color{true};
+    gbase::String path;
+
+    for (int i = 1; i < argc; ++i) {
+        const gbase::String argument{argv[i]};
+        if (argument == "--no-color") {
+            color = false;
+        } else {
+            path = argument;
+        }
+    }
+
+    if (path.empty()) {
+        std::cerr << "Usage: glog_decode [--no-color] <file>" << std::endl;
+        return 2;
+    }
+
+    try {
+        gbase::GBinaryLogReader reader{path};
+        gbase::GLogBuffer<gbase::LogMessageCapacity> record;
+
+        while (const auto entry = reader.next()) {
+            record.clear();
+            const auto timestamp = gbase::GTimestampCache::render(
+                std::chrono::duration_cast<std::chrono::milliseconds>(entry->timeSinceEpoch));
+            const std::string_view timestampText{timestamp.data(), timestamp.size()};
+            gbase::appendLogRecord(record, entry->severity, timestampText, entry->message(), color);
+            std::cout << record.view() << '\n';
+        }
+    } catch (const gbase::GException &exception) {
+        std::cerr << exception << std::endl;
+        return 1;
+    }
+
+    return 0;
+}